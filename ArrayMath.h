@@ -0,0 +1,434 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <type_traits>
+#include "Simd.h"
+
+//Lazy element wise arithmetic over float arrays. Operators on spans and scalars only build an expression type, assigning one to an
+//FArraySpan runs a single loop over the destination in float32_8 chunks, so Out = A * B + C * D reads every input once and writes Out
+//once instead of streaming through memory for every operation. A product feeding an addition or subtraction becomes one fma, the loop
+//evaluates four chunks per iteration and the last partial chunk uses masked loads and stores, so nothing past the arrays is touched.
+//Inputs must hold at least as many floats as the destination and may alias it only at the same positions. 32 byte aligned data avoids
+//loads that split cache lines but is not required
+namespace ArrayMath
+{
+
+    struct FConstArraySpan final
+    {
+        const float32* Data;
+        uint64 Num;
+    };
+
+    //A destination for expressions, also usable as an operand. Assigning to it, including from another FArraySpan, writes the
+    //elements and never rebinds the span
+    class FArraySpan final
+    {
+    public:
+
+        FArraySpan(float32* InData, const uint64 InNum)
+            : Data(InData)
+            , Num(InNum)
+        {
+        }
+
+        FArraySpan(const FArraySpan&) = default;
+
+        operator FConstArraySpan() const
+        {
+            return FConstArraySpan{Data, Num};
+        }
+
+        template<typename TExpression>
+        ATTRAVX FArraySpan& operator=(const TExpression& Expression);
+
+        ATTRAVX FArraySpan& operator=(const FArraySpan& Other);
+
+        template<typename TExpression>
+        ATTRAVX FArraySpan& operator+=(const TExpression& Expression);
+
+        template<typename TExpression>
+        ATTRAVX FArraySpan& operator-=(const TExpression& Expression);
+
+        template<typename TExpression>
+        ATTRAVX FArraySpan& operator*=(const TExpression& Expression);
+
+        inline float32* GetData() const
+        {
+            return Data;
+        }
+
+        inline uint64 GetNum() const
+        {
+            return Num;
+        }
+
+    private:
+
+        float32* Data;
+        uint64 Num;
+
+    };
+
+    //the base of every expression node, it also makes ADL find the operators below for them
+    struct FExpression
+    {
+    };
+
+    namespace Internal
+    {
+
+        enum class EOperation : uint8
+        {
+            Add,
+            Subtract,
+            Multiply,
+            Divide,
+            Min,
+            Max,
+            Negate,
+            Absolute,
+            SquareRoot
+        };
+
+        //the lanes a chunk may touch, all set outside the tail
+        using FLaneMask = Simd::Internal::int32_8;
+
+        struct FLoad final : FExpression
+        {
+            template<bool bMasked>
+            ATTRAVX Simd::float32_8 Evaluate(const uint64 Index, const FLaneMask& Mask) const
+            {
+                if constexpr(bMasked)
+                {
+                    return Simd::float32_8{__builtin_ia32_maskloadps256(reinterpret_cast<const Simd::Internal::float32_8*>(Data + Index), Mask)};
+                }
+                else
+                {
+                    return Simd::Load<Simd::float32_8>(Data + Index);
+                }
+            }
+
+            const float32* Data;
+        };
+
+        struct FScalar final : FExpression
+        {
+            template<bool bMasked>
+            ATTRAVX Simd::float32_8 Evaluate(const uint64, const FLaneMask&) const
+            {
+                return Simd::float32_8{Value};
+            }
+
+            float32 Value;
+        };
+
+        template<EOperation Operation, typename TOperand>
+        struct TUnary final : FExpression
+        {
+            template<bool bMasked>
+            ATTRAVX Simd::float32_8 Evaluate(const uint64 Index, const FLaneMask& Mask) const
+            {
+                const Simd::float32_8 Value{Operand.template Evaluate<bMasked>(Index, Mask)};
+
+                if constexpr(Operation == EOperation::Negate)
+                {
+                    return Simd::float32_8{-Value.Vector};
+                }
+                else if constexpr(Operation == EOperation::Absolute)
+                {
+                    return Simd::Absolute(Value);
+                }
+                else if constexpr(Operation == EOperation::SquareRoot)
+                {
+                    return Simd::float32_8{__builtin_ia32_sqrtps256(Value.Vector)};
+                }
+            }
+
+            TOperand Operand;
+        };
+
+        template<EOperation Operation, typename TLHS, typename TRHS>
+        struct TBinary final : FExpression
+        {
+            template<bool bMasked>
+            ATTRAVX Simd::float32_8 Evaluate(const uint64 Index, const FLaneMask& Mask) const
+            {
+                constexpr bool bContractLHS{(Operation == EOperation::Add || Operation == EOperation::Subtract) && IsProduct<TLHS>()};
+                constexpr bool bContractRHS{(Operation == EOperation::Add || Operation == EOperation::Subtract) && IsProduct<TRHS>()};
+
+                //A * B + C, A * B - C, C + A * B and C - A * B all become one fma with the negations folded into its operands
+                if constexpr(bContractLHS)
+                {
+                    const Simd::float32_8 Addend{RHS.template Evaluate<bMasked>(Index, Mask)};
+
+                    return Simd::FusedMultiplyAdd(LHS.LHS.template Evaluate<bMasked>(Index, Mask), LHS.RHS.template Evaluate<bMasked>(Index, Mask),
+                        Operation == EOperation::Add ? Addend : Simd::float32_8{-Addend.Vector});
+                }
+                else if constexpr(bContractRHS)
+                {
+                    const Simd::float32_8 Factor{RHS.LHS.template Evaluate<bMasked>(Index, Mask)};
+
+                    return Simd::FusedMultiplyAdd(Operation == EOperation::Add ? Factor : Simd::float32_8{-Factor.Vector}, RHS.RHS.template Evaluate<bMasked>(Index, Mask),
+                        LHS.template Evaluate<bMasked>(Index, Mask));
+                }
+                else
+                {
+                    const Simd::float32_8 Left{LHS.template Evaluate<bMasked>(Index, Mask)};
+                    const Simd::float32_8 Right{RHS.template Evaluate<bMasked>(Index, Mask)};
+
+                    if constexpr(Operation == EOperation::Add)
+                    {
+                        return Left + Right;
+                    }
+                    else if constexpr(Operation == EOperation::Subtract)
+                    {
+                        return Left - Right;
+                    }
+                    else if constexpr(Operation == EOperation::Multiply)
+                    {
+                        return Left * Right;
+                    }
+                    else if constexpr(Operation == EOperation::Divide)
+                    {
+                        return Left / Right;
+                    }
+                    else if constexpr(Operation == EOperation::Min)
+                    {
+                        return Simd::float32_8{__builtin_elementwise_min(Left.Vector, Right.Vector)};
+                    }
+                    else if constexpr(Operation == EOperation::Max)
+                    {
+                        return Simd::float32_8{__builtin_elementwise_max(Left.Vector, Right.Vector)};
+                    }
+                }
+            }
+
+            template<typename TOperand>
+            static consteval bool IsProduct()
+            {
+                return requires { TOperand::bIsProduct; };
+            }
+
+            TLHS LHS;
+            TRHS RHS;
+        };
+
+        //products are marked so the addition above them can see through them, their evaluation is the plain multiply
+        template<typename TLHS, typename TRHS>
+        struct TProduct final : FExpression
+        {
+            inline static constexpr bool bIsProduct{true};
+
+            template<bool bMasked>
+            ATTRAVX Simd::float32_8 Evaluate(const uint64 Index, const FLaneMask& Mask) const
+            {
+                return LHS.template Evaluate<bMasked>(Index, Mask) * RHS.template Evaluate<bMasked>(Index, Mask);
+            }
+
+            TLHS LHS;
+            TRHS RHS;
+        };
+
+        template<typename T>
+        inline constexpr bool bIsOperand{std::is_base_of_v<FExpression, T> || std::is_same_v<T, FArraySpan> || std::is_same_v<T, FConstArraySpan> || std::is_arithmetic_v<T>};
+
+        //at least one side has to be an array or an expression, two plain numbers keep their usual operators
+        template<typename TLHS, typename TRHS>
+        inline constexpr bool bIsOperation{bIsOperand<TLHS> && bIsOperand<TRHS> && !(std::is_arithmetic_v<TLHS> && std::is_arithmetic_v<TRHS>)};
+
+        //spans become loads and numbers broadcasts, expressions are taken as they are
+        template<typename T>
+        ATTRAVX auto AsExpression(const T& Operand)
+        {
+            if constexpr(std::is_base_of_v<FExpression, T>)
+            {
+                return Operand;
+            }
+            else if constexpr(std::is_same_v<T, FArraySpan>)
+            {
+                return FLoad{{}, Operand.GetData()};
+            }
+            else if constexpr(std::is_same_v<T, FConstArraySpan>)
+            {
+                return FLoad{{}, Operand.Data};
+            }
+            else
+            {
+                return FScalar{{}, static_cast<float32>(Operand)};
+            }
+        }
+
+        template<EOperation Operation, typename TLHS, typename TRHS>
+        ATTRAVX auto MakeBinary(const TLHS& LHS, const TRHS& RHS)
+        {
+            using FLHS = decltype(AsExpression(LHS));
+            using FRHS = decltype(AsExpression(RHS));
+
+            if constexpr(Operation == EOperation::Multiply)
+            {
+                return TProduct<FLHS, FRHS>{{}, AsExpression(LHS), AsExpression(RHS)};
+            }
+            else
+            {
+                return TBinary<Operation, FLHS, FRHS>{{}, AsExpression(LHS), AsExpression(RHS)};
+            }
+        }
+
+        template<EOperation Operation, typename TOperand>
+        ATTRAVX auto MakeUnary(const TOperand& Operand)
+        {
+            return TUnary<Operation, decltype(AsExpression(Operand))>{{}, AsExpression(Operand)};
+        }
+
+        template<typename TExpression>
+        ATTRAVX void Assign(float32* Out, const uint64 Num, const TExpression& Expression)
+        {
+            constexpr uint64 Width{Simd::float32_8::NumElements};
+            const FLaneMask AllLanes{~FLaneMask{}};
+
+            uint64 Index{0};
+
+            //the four chunks are independent, evaluating them together keeps more loads in flight and halves the loop overhead
+            for(; Index + 4 * Width <= Num; Index += 4 * Width)
+            {
+                const Simd::float32_8 Chunk0{Expression.template Evaluate<false>(Index, AllLanes)};
+                const Simd::float32_8 Chunk1{Expression.template Evaluate<false>(Index + Width, AllLanes)};
+                const Simd::float32_8 Chunk2{Expression.template Evaluate<false>(Index + 2 * Width, AllLanes)};
+                const Simd::float32_8 Chunk3{Expression.template Evaluate<false>(Index + 3 * Width, AllLanes)};
+
+                Memory::Copy(Out + Index, Chunk0.ToPtr(), sizeof(Chunk0));
+                Memory::Copy(Out + Index + Width, Chunk1.ToPtr(), sizeof(Chunk1));
+                Memory::Copy(Out + Index + 2 * Width, Chunk2.ToPtr(), sizeof(Chunk2));
+                Memory::Copy(Out + Index + 3 * Width, Chunk3.ToPtr(), sizeof(Chunk3));
+            }
+
+            for(; Index + Width <= Num; Index += Width)
+            {
+                const Simd::float32_8 Chunk{Expression.template Evaluate<false>(Index, AllLanes)};
+                Memory::Copy(Out + Index, Chunk.ToPtr(), sizeof(Chunk));
+            }
+
+            if(Index < Num)
+            {
+                const FLaneMask Lanes{0, 1, 2, 3, 4, 5, 6, 7};
+                const FLaneMask Mask{Lanes < static_cast<int32>(Num - Index)};
+
+                const Simd::float32_8 Chunk{Expression.template Evaluate<true>(Index, Mask)};
+                __builtin_ia32_maskstoreps256(reinterpret_cast<Simd::Internal::float32_8*>(Out + Index), Mask, Chunk.Vector);
+            }
+        }
+
+    }
+
+    template<typename TExpression>
+    ATTRAVX FArraySpan& FArraySpan::operator=(const TExpression& Expression)
+    {
+        static_assert(Internal::bIsOperand<TExpression>);
+
+        Internal::Assign(Data, Num, Internal::AsExpression(Expression));
+        return *this;
+    }
+
+    ATTRAVX FArraySpan& FArraySpan::operator=(const FArraySpan& Other)
+    {
+        Internal::Assign(Data, Num, Internal::AsExpression(Other));
+        return *this;
+    }
+
+    template<typename TExpression>
+    ATTRAVX FArraySpan& FArraySpan::operator+=(const TExpression& Expression)
+    {
+        Internal::Assign(Data, Num, Internal::MakeBinary<Internal::EOperation::Add>(*this, Expression));
+        return *this;
+    }
+
+    template<typename TExpression>
+    ATTRAVX FArraySpan& FArraySpan::operator-=(const TExpression& Expression)
+    {
+        Internal::Assign(Data, Num, Internal::MakeBinary<Internal::EOperation::Subtract>(*this, Expression));
+        return *this;
+    }
+
+    template<typename TExpression>
+    ATTRAVX FArraySpan& FArraySpan::operator*=(const TExpression& Expression)
+    {
+        Internal::Assign(Data, Num, Internal::MakeBinary<Internal::EOperation::Multiply>(*this, Expression));
+        return *this;
+    }
+
+    template<typename TLHS, typename TRHS>
+    requires Internal::bIsOperation<TLHS, TRHS>
+    ATTRAVX auto operator+(const TLHS& LHS, const TRHS& RHS)
+    {
+        return Internal::MakeBinary<Internal::EOperation::Add>(LHS, RHS);
+    }
+
+    template<typename TLHS, typename TRHS>
+    requires Internal::bIsOperation<TLHS, TRHS>
+    ATTRAVX auto operator-(const TLHS& LHS, const TRHS& RHS)
+    {
+        return Internal::MakeBinary<Internal::EOperation::Subtract>(LHS, RHS);
+    }
+
+    template<typename TLHS, typename TRHS>
+    requires Internal::bIsOperation<TLHS, TRHS>
+    ATTRAVX auto operator*(const TLHS& LHS, const TRHS& RHS)
+    {
+        return Internal::MakeBinary<Internal::EOperation::Multiply>(LHS, RHS);
+    }
+
+    template<typename TLHS, typename TRHS>
+    requires Internal::bIsOperation<TLHS, TRHS>
+    ATTRAVX auto operator/(const TLHS& LHS, const TRHS& RHS)
+    {
+        return Internal::MakeBinary<Internal::EOperation::Divide>(LHS, RHS);
+    }
+
+    template<typename TOperand>
+    requires (Internal::bIsOperand<TOperand> && !std::is_arithmetic_v<TOperand>)
+    ATTRAVX auto operator-(const TOperand& Operand)
+    {
+        return Internal::MakeUnary<Internal::EOperation::Negate>(Operand);
+    }
+
+    template<typename TLHS, typename TRHS>
+    requires Internal::bIsOperation<TLHS, TRHS>
+    ATTRAVX auto Min(const TLHS& LHS, const TRHS& RHS)
+    {
+        return Internal::MakeBinary<Internal::EOperation::Min>(LHS, RHS);
+    }
+
+    template<typename TLHS, typename TRHS>
+    requires Internal::bIsOperation<TLHS, TRHS>
+    ATTRAVX auto Max(const TLHS& LHS, const TRHS& RHS)
+    {
+        return Internal::MakeBinary<Internal::EOperation::Max>(LHS, RHS);
+    }
+
+    template<typename TOperand>
+    requires (Internal::bIsOperand<TOperand> && !std::is_arithmetic_v<TOperand>)
+    ATTRAVX auto Absolute(const TOperand& Operand)
+    {
+        return Internal::MakeUnary<Internal::EOperation::Absolute>(Operand);
+    }
+
+    template<typename TOperand>
+    requires (Internal::bIsOperand<TOperand> && !std::is_arithmetic_v<TOperand>)
+    ATTRAVX auto SquareRoot(const TOperand& Operand)
+    {
+        return Internal::MakeUnary<Internal::EOperation::SquareRoot>(Operand);
+    }
+
+}
@@ -0,0 +1,126 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+//Blends RGBA8 rows of Source over Destination with the source alpha, once per pixel in scalar code and 8 pixels at a time with the 16 bit lane operations
+
+#include <chrono>
+#include <cstdio>
+#include "../Simd.h"
+
+namespace
+{
+    constexpr uint64 Width{1920};
+    constexpr uint64 Height{1080};
+    constexpr uint64 NumBytes{Width * Height * 4};
+    constexpr int32 NumRuns{20};
+
+    //(Value + 127) / 255 for Value <= 255 * 255, exact without a division
+    inline uint8 DivideBy255(const uint32 Value)
+    {
+        const uint32 Rounded{Value + 128};
+        return static_cast<uint8>((Rounded + (Rounded >> 8)) >> 8);
+    }
+
+    __attribute__((noinline)) void BlendScalar(const uint8* Source, uint8* Destination, const uint64 Num)
+    {
+        for(uint64 Index{0}; Index < Num; Index += 4)
+        {
+            const uint32 Alpha{Source[Index + 3]};
+
+            for(uint64 Channel{0}; Channel < 4; ++Channel)
+            {
+                Destination[Index + Channel] = DivideBy255(Source[Index + Channel] * Alpha + Destination[Index + Channel] * (255 - Alpha));
+            }
+        }
+    }
+
+    //Same rounding as DivideBy255, the multiply high by 257 folds the second shift and add into one pmulhuw
+    ATTRAVX Simd::uint16_16 BlendHalf(const Simd::uint16_16& Source, const Simd::uint16_16& Destination)
+    {
+        const Simd::uint16_16 Alpha{Simd::ShuffleVector<Simd::uint16_16, 3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15>(Source)};
+        const Simd::uint16_16 Blended{Source * Alpha + Destination * (Simd::uint16_16{static_cast<uint16>(255)} - Alpha)};
+
+        return Simd::MultiplyHigh(Blended + Simd::uint16_16{static_cast<uint16>(128)}, Simd::uint16_16{static_cast<uint16>(257)});
+    }
+
+    __attribute__((noinline)) void BlendSimd(const uint8* Source, uint8* Destination, const uint64 Num)
+    {
+        for(uint64 Index{0}; Index < Num; Index += Simd::uint8_32::NumElements)
+        {
+            const Simd::uint8_32 SourcePixels{Simd::Load<Simd::uint8_32>(Source + Index)};
+            const Simd::uint8_32 DestinationPixels{Simd::Load<Simd::uint8_32>(Destination + Index)};
+
+            const Simd::uint16_16 Low{BlendHalf(Simd::WidenLow<Simd::uint16_16>(SourcePixels), Simd::WidenLow<Simd::uint16_16>(DestinationPixels))};
+            const Simd::uint16_16 High{BlendHalf(Simd::WidenHigh<Simd::uint16_16>(SourcePixels), Simd::WidenHigh<Simd::uint16_16>(DestinationPixels))};
+
+            const Simd::uint8_32 Result{Simd::Narrow<Simd::uint8_32>(Low, High)};
+            Memory::Copy(Destination + Index, Result.ToPtr(), sizeof(Result));
+        }
+    }
+
+    template<typename TBlend>
+    double Measure(TBlend Blend, const uint8* Source, uint8* Destination, const uint8* Background)
+    {
+        double Best{1e30};
+
+        for(int32 Run{0}; Run < NumRuns; ++Run)
+        {
+            Memory::Copy(Destination, Background, NumBytes);
+
+            const auto Start{std::chrono::steady_clock::now()};
+            Blend(Source, Destination, NumBytes);
+            const auto End{std::chrono::steady_clock::now()};
+
+            const double Elapsed{std::chrono::duration<double, std::milli>(End - Start).count()};
+            Best = Elapsed < Best ? Elapsed : Best;
+        }
+
+        return Best;
+    }
+}
+
+int main()
+{
+    uint8* Source{Memory::AllocateAligned<32, uint8>(NumBytes)};
+    uint8* Background{Memory::AllocateAligned<32, uint8>(NumBytes)};
+    uint8* ScalarResult{Memory::AllocateAligned<32, uint8>(NumBytes)};
+    uint8* SimdResult{Memory::AllocateAligned<32, uint8>(NumBytes)};
+
+    uint32 State{0x9E3779B9};
+    for(uint64 Index{0}; Index < NumBytes; ++Index)
+    {
+        State ^= State << 13;
+        State ^= State >> 17;
+        State ^= State << 5;
+
+        Source[Index] = static_cast<uint8>(State);
+        Background[Index] = static_cast<uint8>(State >> 8);
+    }
+
+    const double ScalarTime{Measure(BlendScalar, Source, ScalarResult, Background)};
+    const double SimdTime{Measure(BlendSimd, Source, SimdResult, Background)};
+
+    const bool bMatches{__builtin_memcmp(ScalarResult, SimdResult, NumBytes) == 0};
+
+    std::printf("alpha blend %llux%llu RGBA8, best of %d\n", Width, Height, NumRuns);
+    std::printf("scalar %8.3f ms\n", ScalarTime);
+    std::printf("simd   %8.3f ms  %.2fx\n", SimdTime, ScalarTime / SimdTime);
+    std::printf("results %s\n", bMatches ? "match" : "differ");
+
+    Memory::FreeAligned<32>(Source);
+    Memory::FreeAligned<32>(Background);
+    Memory::FreeAligned<32>(ScalarResult);
+    Memory::FreeAligned<32>(SimdResult);
+
+    return bMatches ? 0 : 1;
+}
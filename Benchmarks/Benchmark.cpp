@@ -0,0 +1,63 @@
+//Runs every benchmark and prints the results as JSON, to the file given as the first argument or to stdout.
+//Results of two builds can be diffed by group, name and variant
+
+#include <cstdio>
+#include "Benchmark.h"
+
+namespace
+{
+    constexpr int32 MaxResults{1024};
+
+    Benchmark::FResult Results[MaxResults];
+    int32 NumResults{0};
+}
+
+void Benchmark::AddResult(const FResult& Result)
+{
+    if(NumResults < MaxResults)
+    {
+        Results[NumResults++] = Result;
+    }
+}
+
+int main(int ArgumentCount, char8** Arguments)
+{
+    if(!Simd::IsSupportedByCpu())
+    {
+        std::fprintf(stderr, "%s is not supported by this cpu\n", SIMD_ISA_NAME);
+        return 1;
+    }
+
+    std::FILE* Output{ArgumentCount > 1 ? std::fopen(Arguments[1], "w") : stdout};
+    if(Output == nullptr)
+    {
+        std::fprintf(stderr, "can't open %s\n", Arguments[1]);
+        return 1;
+    }
+
+    Benchmark::RunSimd();
+    Benchmark::RunString();
+
+    std::fprintf(Output, "{\n");
+    std::fprintf(Output, "  \"isa\": \"%s\",\n", SIMD_ISA_NAME);
+    std::fprintf(Output, "  \"compiler\": \"%s\",\n", __VERSION__);
+    std::fprintf(Output, "  \"inputs\": %llu,\n  \"passes\": %d,\n  \"runs\": %d,\n", Benchmark::NumInputs, Benchmark::NumPasses, Benchmark::NumRuns);
+    std::fprintf(Output, "  \"results\": [\n");
+
+    for(int32 Index{0}; Index < NumResults; ++Index)
+    {
+        const Benchmark::FResult& Result{Results[Index]};
+
+        std::fprintf(Output, "    {\"group\": \"%s\", \"name\": \"%s\", \"variant\": \"%s\", \"elements\": %llu, \"throughput_ns\": %.4f, \"latency_ns\": %.4f}%s\n",
+            Result.Group, Result.Name, Result.Variant, Result.NumElements, Result.ThroughputNs, Result.LatencyNs, Index + 1 < NumResults ? "," : "");
+    }
+
+    std::fprintf(Output, "  ]\n}\n");
+
+    if(Output != stdout)
+    {
+        std::fclose(Output);
+    }
+
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include "../Simd.h"
+
+//Every benchmark times one step function two ways. Throughput applies it to NumInputs independent values so the cpu can overlap the calls,
+//latency picks the next input with the result of the previous call so each one waits for the one before. Both are the best of NumRuns
+//in nanoseconds per call, the cost of picking the input is measured with a step that does nothing and taken off the latency
+namespace Benchmark
+{
+
+    inline constexpr uint64 NumInputs{1024};
+    inline constexpr int32 NumPasses{16};
+    inline constexpr int32 NumRuns{15};
+
+    struct FResult final
+    {
+        const char8* Group;
+        const char8* Name;
+
+        //"simd" for this library, "scalar" for a plain loop over the elements and "std" for the standard library equivalent
+        const char8* Variant;
+
+        //how many lanes, characters or bytes one call handles, the per element cost is the per call cost divided by it
+        uint64 NumElements;
+
+        float64 ThroughputNs;
+        float64 LatencyNs;
+    };
+
+    void AddResult(const FResult& Result);
+
+    void RunSimd();
+    void RunString();
+
+    //keeps the compiler from folding Value away or from hoisting the work that produced it out of the timed loop
+    template<typename T>
+    INLINE void KeepAlive(T& Value)
+    {
+        if constexpr(requires { Value.Vector; })
+        {
+            asm volatile("" : "+x"(Value.Vector));
+        }
+        else if constexpr(std::is_floating_point_v<T>)
+        {
+            asm volatile("" : "+x"(Value));
+        }
+        else if constexpr(std::is_integral_v<T> || std::is_pointer_v<T>)
+        {
+            asm volatile("" : "+r"(Value));
+        }
+        else
+        {
+            asm volatile("" : "+m"(Value));
+        }
+    }
+
+    //A zero the compiler can't see through that still waits for Value. An and with zero is not one of the idioms that break the dependency
+    template<typename T>
+    INLINE uint64 DependOn(const T& Value)
+    {
+        uint64 Bits{0};
+
+        if constexpr(requires { Value.Vector; })
+        {
+            asm volatile("vmovq %x1, %0" : "=r"(Bits) : "x"(Value.Vector));
+        }
+        else if constexpr(std::is_floating_point_v<T>)
+        {
+            asm volatile("vmovq %x1, %0" : "=r"(Bits) : "x"(Value));
+        }
+        else if constexpr(std::is_integral_v<T>)
+        {
+            Bits = static_cast<uint64>(Value);
+        }
+        else
+        {
+            Memory::Copy(&Bits, &Value, sizeof(T) < sizeof(Bits) ? sizeof(T) : sizeof(Bits));
+        }
+
+        asm volatile("and $0, %0" : "+r"(Bits));
+        return Bits;
+    }
+
+    template<typename T, typename TStep>
+    float64 MeasureLatency(const T* Inputs, TStep Step)
+    {
+        uint64 Index{0};
+
+        const auto Start{std::chrono::steady_clock::now()};
+        for(int32 Pass{0}; Pass < NumPasses; ++Pass)
+        {
+            for(uint64 Call{0}; Call < NumInputs; ++Call)
+            {
+                const auto Result{Step(Inputs[Index])};
+                Index = (Index + 1 + DependOn(Result)) & (NumInputs - 1);
+            }
+        }
+        const auto End{std::chrono::steady_clock::now()};
+
+        return std::chrono::duration<float64, std::nano>(End - Start).count() / (static_cast<float64>(NumInputs) * NumPasses);
+    }
+
+    template<typename T, typename TStep>
+    float64 MeasureThroughput(const T* Inputs, TStep Step)
+    {
+        const auto Start{std::chrono::steady_clock::now()};
+        for(int32 Pass{0}; Pass < NumPasses; ++Pass)
+        {
+            for(uint64 Index{0}; Index < NumInputs; ++Index)
+            {
+                T Input{Inputs[Index]};
+                KeepAlive(Input);
+
+                auto Result{Step(Input)};
+                KeepAlive(Result);
+            }
+        }
+        const auto End{std::chrono::steady_clock::now()};
+
+        return std::chrono::duration<float64, std::nano>(End - Start).count() / (static_cast<float64>(NumInputs) * NumPasses);
+    }
+
+    //Step takes a const T& and may return anything, MakeInput(Index) fills the inputs once before timing
+    template<typename T, typename TMakeInput, typename TStep>
+    void Run(const char8* Group, const char8* Name, const char8* Variant, const uint64 NumElements, TMakeInput MakeInput, TStep Step)
+    {
+        static_assert((NumInputs & (NumInputs - 1)) == 0);
+
+        alignas(64) static T Inputs[NumInputs];
+
+        for(uint64 Index{0}; Index < NumInputs; ++Index)
+        {
+            Inputs[Index] = MakeInput(Index);
+        }
+
+        float64 BestThroughput{1e30};
+        float64 BestLatency{1e30};
+        float64 BestOverhead{1e30};
+
+        for(int32 Run{0}; Run < NumRuns; ++Run)
+        {
+            const float64 Throughput{MeasureThroughput(Inputs, Step)};
+            const float64 Latency{MeasureLatency(Inputs, Step)};
+            const float64 Overhead{MeasureLatency(Inputs, [](const T& Input)
+            {
+                return Input;
+            })};
+
+            BestThroughput = Throughput < BestThroughput ? Throughput : BestThroughput;
+            BestLatency = Latency < BestLatency ? Latency : BestLatency;
+            BestOverhead = Overhead < BestOverhead ? Overhead : BestOverhead;
+        }
+
+        AddResult(FResult{Group, Name, Variant, NumElements, BestThroughput, BestLatency > BestOverhead ? BestLatency - BestOverhead : 0.0});
+    }
+
+}
@@ -0,0 +1,650 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string_view>
+#include "Benchmark.h"
+#include "../Divider.h"
+#include "../Hash.h"
+#include "../PopCount.h"
+#include "../Random.h"
+
+namespace
+{
+    constexpr uint64 BufferSize{4096};
+
+    //room for BufferSize bytes at any offset below 64
+    alignas(64) uint8 Buffer[BufferSize + 64];
+
+    uint64 SplitMix(uint64 Value)
+    {
+        Value += 0x9E3779B97F4A7C15ull;
+        Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+        return Value ^ (Value >> 31);
+    }
+
+    template<typename T>
+    T MakeElement(const uint64 Seed)
+    {
+        const uint64 Bits{SplitMix(Seed)};
+
+        if constexpr(std::is_floating_point_v<T>)
+        {
+            return static_cast<T>(static_cast<int32>(Bits % 2000) - 1000) * static_cast<T>(0.125);
+        }
+        else
+        {
+            return static_cast<T>(Bits);
+        }
+    }
+
+    template<typename T>
+    T MakeInput(const uint64 Index)
+    {
+        if constexpr(requires { T::NumElements; })
+        {
+            T Input;
+            for(uint64 Lane{0}; Lane < T::NumElements; ++Lane)
+            {
+                Input[Lane] = MakeElement<typename T::ElementType>(Index * T::NumElements + Lane);
+            }
+            return Input;
+        }
+        else
+        {
+            return MakeElement<T>(Index);
+        }
+    }
+
+    //one result for the whole register and one for a single lane of the scalar or std equivalent
+    template<typename TVector, typename TSimdStep, typename TScalarStep>
+    void Compare(const char8* Group, const char8* Name, TSimdStep SimdStep, const char8* ScalarVariant, TScalarStep ScalarStep)
+    {
+        using ElementType = typename TVector::ElementType;
+
+        Benchmark::Run<TVector>(Group, Name, "simd", TVector::NumElements, MakeInput<TVector>, SimdStep);
+        Benchmark::Run<ElementType>(Group, Name, ScalarVariant, 1, MakeInput<ElementType>, ScalarStep);
+    }
+
+    //the buffer functions take an offset below 64 as input so the latency chain can move the start
+    template<typename TStep>
+    void RunBuffer(const char8* Group, const char8* Name, const char8* Variant, const uint64 Size, TStep Step)
+    {
+        Benchmark::Run<uint64>(Group, Name, Variant, Size, [](const uint64 Index)
+        {
+            return SplitMix(Index) & 63;
+        }, Step);
+    }
+
+    //the registers one call of a transpose or an interleave works on
+    template<typename TVector, uint64 NumRows>
+    struct TRegisters final
+    {
+        TVector Rows[NumRows];
+    };
+
+    template<typename TVector, uint64 NumRows>
+    TRegisters<TVector, NumRows> MakeRegisters(const uint64 Index)
+    {
+        TRegisters<TVector, NumRows> Registers;
+        for(uint64 Row{0}; Row < NumRows; ++Row)
+        {
+            Registers.Rows[Row] = MakeInput<TVector>(Index * NumRows + Row);
+        }
+        return Registers;
+    }
+
+    //every output row xored into one register, so the latency chain waits for all of them
+    template<typename TVector, uint64 NumRows>
+    TVector CombineRows(const TVector (&Rows)[NumRows])
+    {
+        TVector Combined{Rows[0]};
+        for(uint64 Row{1}; Row < NumRows; ++Row)
+        {
+            Combined ^= Rows[Row];
+        }
+        return Combined;
+    }
+
+    //the scalar baseline for Crc32C, one crc32 instruction per 8 bytes in a single dependency chain
+    uint32 Crc32CSerial(const uint8* Data, const uint64 Size)
+    {
+        uint64 Crc{0xFFFFFFFF};
+        for(uint64 Index{0}; Index < Size; Index += sizeof(uint64))
+        {
+            uint64 Word;
+            Memory::Copy(&Word, Data + Index, sizeof(Word));
+            Crc = __builtin_ia32_crc32di(Crc, Word);
+        }
+        return ~static_cast<uint32>(Crc);
+    }
+}
+
+void Benchmark::RunSimd()
+{
+    for(uint64 Index{0}; Index < sizeof(Buffer); ++Index)
+    {
+        Buffer[Index] = static_cast<uint8>(SplitMix(Index));
+    }
+
+    Compare<Simd::int32_8>("Add", "int32_8", [](const Simd::int32_8& X)
+    {
+        return X + Simd::int32_8{12345};
+    }, "scalar", [](const int32 X)
+    {
+        return X + 12345;
+    });
+
+    Compare<Simd::float32_8>("Multiply", "float32_8", [](const Simd::float32_8& X)
+    {
+        return X * Simd::float32_8{1.0001f};
+    }, "scalar", [](const float32 X)
+    {
+        return X * 1.0001f;
+    });
+
+    Compare<Simd::float32_8>("MakeFromGreater", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::MakeFromGreater(X, Simd::float32_8{10.f});
+    }, "std", [](const float32 X)
+    {
+        return std::max(X, 10.f);
+    });
+
+    Compare<Simd::float32_8>("MakeFromLesser", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::MakeFromLesser(X, Simd::float32_8{10.f});
+    }, "std", [](const float32 X)
+    {
+        return std::min(X, 10.f);
+    });
+
+    Compare<Simd::float32_8>("FusedMultiplyAdd", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::FusedMultiplyAdd(X, Simd::float32_8{1.0001f}, Simd::float32_8{0.5f});
+    }, "std", [](const float32 X)
+    {
+        return std::fma(X, 1.0001f, 0.5f);
+    });
+
+    //one call adds two neighbouring products, the scalar side does the same for one pair of 16 bit values packed into an int32
+    Benchmark::Run<Simd::int16_16>("MultiplyAddPairs", "int16_16", "simd", 8, MakeInput<Simd::int16_16>, [](const Simd::int16_16& X)
+    {
+        return Simd::MultiplyAddPairs(X, Simd::int16_16{static_cast<int16>(-3)});
+    });
+    Benchmark::Run<int32>("MultiplyAddPairs", "int16_16", "scalar", 1, MakeInput<int32>, [](const int32 X)
+    {
+        return static_cast<int16>(X) * -3 + static_cast<int16>(X >> 16) * -3;
+    });
+
+    //16 pairs of unsigned and signed bytes, the scalar side does one pair packed into a uint16. Pairs that add up to more than 327 saturate
+    Benchmark::Run<Simd::uint8_32>("MultiplyAddPairsSaturate", "uint8_32", "simd", 16, MakeInput<Simd::uint8_32>, [](const Simd::uint8_32& X)
+    {
+        return Simd::MultiplyAddPairsSaturate(X, Simd::int8_32{static_cast<int8>(100)});
+    });
+    Benchmark::Run<uint16>("MultiplyAddPairsSaturate", "uint8_32", "scalar", 1, MakeInput<uint16>, [](const uint16 X)
+    {
+        return static_cast<int16>(std::clamp((X & 0xFF) * 100 + (X >> 8) * 100, -32768, 32767));
+    });
+
+    Compare<Simd::int16_16>("Absolute", "int16_16", [](const Simd::int16_16& X)
+    {
+        return Simd::Absolute(X);
+    }, "std", [](const int16 X)
+    {
+        return static_cast<int16>(std::abs(X));
+    });
+
+    Compare<Simd::float32_8>("CompareGreater", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::CompareGreater(X, Simd::float32_8{10.f});
+    }, "scalar", [](const float32 X)
+    {
+        return X > 10.f;
+    });
+
+    Compare<Simd::float32_8>("CompareGreaterOrEqual", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::CompareGreaterOrEqual(X, Simd::float32_8{10.f});
+    }, "scalar", [](const float32 X)
+    {
+        return X >= 10.f;
+    });
+
+    Compare<Simd::float32_8>("CompareLesser", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::CompareLesser(X, Simd::float32_8{10.f});
+    }, "scalar", [](const float32 X)
+    {
+        return X < 10.f;
+    });
+
+    Compare<Simd::float32_8>("CompareLesserOrEqual", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::CompareLesserOrEqual(X, Simd::float32_8{10.f});
+    }, "scalar", [](const float32 X)
+    {
+        return X <= 10.f;
+    });
+
+    Compare<Simd::float32_8>("CompareEqual", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::CompareEqual(X, Simd::float32_8{10.f});
+    }, "scalar", [](const float32 X)
+    {
+        return X == 10.f;
+    });
+
+    Compare<Simd::float32_8>("CompareNotEqual", "float32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::CompareNotEqual(X, Simd::float32_8{10.f});
+    }, "scalar", [](const float32 X)
+    {
+        return X != 10.f;
+    });
+
+    Compare<Simd::int32_8>("Select", "int32_8", [](const Simd::int32_8& X)
+    {
+        return Simd::Select(X > Simd::int32_8{0}, X, Simd::int32_8{7});
+    }, "scalar", [](const int32 X)
+    {
+        return X > 0 ? X : 7;
+    });
+
+    Compare<Simd::int32_8>("MaskedAdd", "int32_8", [](const Simd::int32_8& X)
+    {
+        return Simd::MaskedAdd(X > Simd::int32_8{0}, X, Simd::int32_8{12345});
+    }, "scalar", [](const int32 X)
+    {
+        return X > 0 ? X + 12345 : X;
+    });
+
+    Compare<Simd::int32_8>("MaskedSubtract", "int32_8", [](const Simd::int32_8& X)
+    {
+        return Simd::MaskedSubtract(X > Simd::int32_8{0}, X, Simd::int32_8{12345});
+    }, "scalar", [](const int32 X)
+    {
+        return X > 0 ? X - 12345 : X;
+    });
+
+    Compare<Simd::int32_8>("MaskedMultiply", "int32_8", [](const Simd::int32_8& X)
+    {
+        return Simd::MaskedMultiply(X > Simd::int32_8{0}, X, Simd::int32_8{3});
+    }, "scalar", [](const int32 X)
+    {
+        return X > 0 ? X * 3 : X;
+    });
+
+    Compare<Simd::uint8_32>("AddSaturate", "uint8_32", [](const Simd::uint8_32& X)
+    {
+        return Simd::AddSaturate(X, Simd::uint8_32{static_cast<uint8>(100)});
+    }, "scalar", [](const uint8 X)
+    {
+        return static_cast<uint8>(X > 155 ? 255 : X + 100);
+    });
+
+    Compare<Simd::uint8_32>("SubtractSaturate", "uint8_32", [](const Simd::uint8_32& X)
+    {
+        return Simd::SubtractSaturate(X, Simd::uint8_32{static_cast<uint8>(100)});
+    }, "scalar", [](const uint8 X)
+    {
+        return static_cast<uint8>(X < 100 ? 0 : X - 100);
+    });
+
+    Compare<Simd::uint32_8>("MultiplyHigh", "uint32_8", [](const Simd::uint32_8& X)
+    {
+        return Simd::MultiplyHigh(X, Simd::uint32_8{0x9E3779B9u});
+    }, "scalar", [](const uint32 X)
+    {
+        return static_cast<uint32>((static_cast<uint64>(X) * 0x9E3779B9u) >> 32);
+    });
+
+    Compare<Simd::uint64_4>("MultiplyHigh", "uint64_4", [](const Simd::uint64_4& X)
+    {
+        return Simd::MultiplyHigh(X, Simd::uint64_4{0x9E3779B97F4A7C15ull});
+    }, "scalar", [](const uint64 X)
+    {
+        return static_cast<uint64>((static_cast<uint128>(X) * 0x9E3779B97F4A7C15ull) >> 64);
+    });
+
+    Compare<Simd::int16_16>("MultiplyHighRound", "int16_16", [](const Simd::int16_16& X)
+    {
+        return Simd::MultiplyHighRound(X, Simd::int16_16{static_cast<int16>(12345)});
+    }, "scalar", [](const int16 X)
+    {
+        return static_cast<int16>((X * 12345 + 0x4000) >> 15);
+    });
+
+    Compare<Simd::uint32_8>("ShiftLeftBits", "uint32_8", [](const Simd::uint32_8& X)
+    {
+        return Simd::ShiftLeftBits<5>(X);
+    }, "scalar", [](const uint32 X)
+    {
+        return X << 5;
+    });
+
+    Compare<Simd::int32_8>("ShiftRightBits", "int32_8", [](const Simd::int32_8& X)
+    {
+        return Simd::ShiftRightBits<5>(X);
+    }, "scalar", [](const int32 X)
+    {
+        return X >> 5;
+    });
+
+    Compare<Simd::uint16_16>("ShiftRightBitsLogical", "uint16_16", [](const Simd::uint16_16& X)
+    {
+        return Simd::ShiftRightBitsLogical<3>(X);
+    }, "scalar", [](const uint16 X)
+    {
+        return static_cast<uint16>(X >> 3);
+    });
+
+    //the sign bit of an unsigned lane shifted in, psrad on uint32 lanes
+    Compare<Simd::uint32_8>("ShiftRightBitsArithmetic", "uint32_8", [](const Simd::uint32_8& X)
+    {
+        return Simd::ShiftRightBitsArithmetic<5>(X);
+    }, "scalar", [](const uint32 X)
+    {
+        return static_cast<uint32>(static_cast<int32>(X) >> 5);
+    });
+
+    //every lane shifted by its own amount, the low bits of the other input
+    Compare<Simd::uint32_8>("ShiftRightBits", "uint32_8 variable", [](const Simd::uint32_8& X)
+    {
+        return Simd::ShiftRightBits(X, X & Simd::uint32_8{31u});
+    }, "scalar", [](const uint32 X)
+    {
+        return X >> (X & 31);
+    });
+
+    Compare<Simd::uint64_4>("RotateLeftBits", "uint64_4", [](const Simd::uint64_4& X)
+    {
+        return Simd::RotateLeftBits<13>(X);
+    }, "std", [](const uint64 X)
+    {
+        return std::rotl(X, 13);
+    });
+
+    Compare<Simd::uint64_4>("RotateRightBits", "uint64_4", [](const Simd::uint64_4& X)
+    {
+        return Simd::RotateRightBits<13>(X);
+    }, "std", [](const uint64 X)
+    {
+        return std::rotr(X, 13);
+    });
+
+    Compare<Simd::uint64_4>("PopCount", "uint64_4", [](const Simd::uint64_4& X)
+    {
+        return Simd::PopCount(X);
+    }, "std", [](const uint64 X)
+    {
+        return std::popcount(X);
+    });
+
+    Compare<Simd::uint32_8>("CountLeadingZeros", "uint32_8", [](const Simd::uint32_8& X)
+    {
+        return Simd::CountLeadingZeros(X);
+    }, "std", [](const uint32 X)
+    {
+        return std::countl_zero(X);
+    });
+
+    Compare<Simd::uint32_8>("CountTrailingZeros", "uint32_8", [](const Simd::uint32_8& X)
+    {
+        return Simd::CountTrailingZeros(X);
+    }, "std", [](const uint32 X)
+    {
+        return std::countr_zero(X);
+    });
+
+    Compare<Simd::uint32_8>("BitReverse", "uint32_8", [](const Simd::uint32_8& X)
+    {
+        return Simd::BitReverse(X);
+    }, "scalar", [](const uint32 X)
+    {
+        return __builtin_bitreverse32(X);
+    });
+
+    Compare<Simd::uint8_32>("Average", "uint8_32", [](const Simd::uint8_32& X)
+    {
+        return Simd::Average(X, Simd::uint8_32{static_cast<uint8>(100)});
+    }, "scalar", [](const uint8 X)
+    {
+        return static_cast<uint8>((X + 101) >> 1);
+    });
+
+    //the widened register holds the lower 16 lanes of the source
+    Benchmark::Run<Simd::uint8_32>("WidenLow", "uint8_32 to uint16_16", "simd", 16, MakeInput<Simd::uint8_32>, [](const Simd::uint8_32& X)
+    {
+        return Simd::WidenLow<Simd::uint16_16>(X);
+    });
+    Benchmark::Run<uint8>("WidenLow", "uint8_32 to uint16_16", "scalar", 1, MakeInput<uint8>, [](const uint8 X)
+    {
+        return static_cast<uint16>(X);
+    });
+
+    //the widened register holds the upper 16 lanes of the source
+    Benchmark::Run<Simd::uint8_32>("WidenHigh", "uint8_32 to uint16_16", "simd", 16, MakeInput<Simd::uint8_32>, [](const Simd::uint8_32& X)
+    {
+        return Simd::WidenHigh<Simd::uint16_16>(X);
+    });
+    Benchmark::Run<uint8>("WidenHigh", "uint8_32 to uint16_16", "scalar", 1, MakeInput<uint8>, [](const uint8 X)
+    {
+        return static_cast<uint16>(X);
+    });
+
+    Compare<Simd::uint16_16>("Narrow", "uint16_16 to uint8_32", [](const Simd::uint16_16& X)
+    {
+        return Simd::Narrow<Simd::uint8_32>(X, X);
+    }, "scalar", [](const uint16 X)
+    {
+        return static_cast<uint8>(X);
+    });
+
+    Compare<Simd::int16_16>("NarrowSaturate", "int16_16 to int8_32", [](const Simd::int16_16& X)
+    {
+        return Simd::NarrowSaturate<Simd::int8_32>(X, X);
+    }, "std", [](const int16 X)
+    {
+        return static_cast<int8>(std::clamp<int16>(X, -128, 127));
+    });
+
+    //loaded at runtime so neither side can use a divisor known to the compiler
+    static volatile uint32 DivisorSource{7};
+    const uint32 Divisor{DivisorSource};
+    const Simd::TDivider<Simd::uint32_8> Divider{Divisor};
+
+    Compare<Simd::uint32_8>("Divide", "uint32_8", [&](const Simd::uint32_8& X)
+    {
+        return X / Divider;
+    }, "scalar", [&](const uint32 X)
+    {
+        return X / Divisor;
+    });
+
+    //integer vectors have no divide instruction, the masked lanes are divided one at a time like the scalar side
+    const Simd::int32_8 Divisors{static_cast<int32>(Divisor)};
+
+    Compare<Simd::int32_8>("MaskedDivide", "int32_8", [&](const Simd::int32_8& X)
+    {
+        return Simd::MaskedDivide(X > Simd::int32_8{0}, X, Divisors);
+    }, "scalar", [&](const int32 X)
+    {
+        return X > 0 ? X / static_cast<int32>(Divisor) : X;
+    });
+
+    Compare<Simd::int32_8>("Convert", "int32_8 to float32_8", [](const Simd::int32_8& X)
+    {
+        return Simd::Convert<Simd::float32_8>(X);
+    }, "scalar", [](const int32 X)
+    {
+        return static_cast<float32>(X);
+    });
+
+    Compare<Simd::float32_8>("Reinterpret", "float32_8 to int32_8", [](const Simd::float32_8& X)
+    {
+        return Simd::Reinterpret<Simd::int32_8>(X);
+    }, "std", [](const float32 X)
+    {
+        return std::bit_cast<int32>(X);
+    });
+
+    Benchmark::Run<int32>("SetAll", "int32_8", "simd", 8, MakeInput<int32>, [](const int32 X)
+    {
+        return Simd::SetAll<Simd::int32_8>(X);
+    });
+
+    //a fixed order of additions against the scalar left to right sum of the same lanes
+    Benchmark::Run<Simd::float32_8>("ReduceAdd", "float32_8", "simd", 8, MakeInput<Simd::float32_8>, [](const Simd::float32_8& X)
+    {
+        return Simd::ReduceAdd(X);
+    });
+    Benchmark::Run<Simd::float32_8>("ReduceAdd", "float32_8", "scalar", 8, MakeInput<Simd::float32_8>, [](const Simd::float32_8& X)
+    {
+        float32 Sum{0.f};
+        for(uint64 Lane{0}; Lane < Simd::float32_8::NumElements; ++Lane)
+        {
+            Sum += X[Lane];
+        }
+        return Sum;
+    });
+
+    //lane movement has no one lane equivalent, these only time the simd side. The shuffle amount is loaded at runtime
+    static volatile int32 ShuffleSource{3};
+    const int32 ShuffleAmount{ShuffleSource};
+
+    Benchmark::Run<Simd::int32_8>("ShuffleLeft", "int32_8", "simd", 8, MakeInput<Simd::int32_8>, [&](const Simd::int32_8& X)
+    {
+        return Simd::ShuffleLeft(X, ShuffleAmount);
+    });
+
+    Benchmark::Run<Simd::int32_8>("ShuffleRight", "int32_8", "simd", 8, MakeInput<Simd::int32_8>, [&](const Simd::int32_8& X)
+    {
+        return Simd::ShuffleRight(X, ShuffleAmount);
+    });
+
+    //reversing the lanes crosses the 128 bit halves, a vpermd
+    Benchmark::Run<Simd::int32_8>("ShuffleVector", "int32_8", "simd", 8, MakeInput<Simd::int32_8>, [](const Simd::int32_8& X)
+    {
+        return Simd::int32_8{Simd::ShuffleVector<Simd::int32_8, 7, 6, 5, 4, 3, 2, 1, 0>(X)};
+    });
+
+    //8 xyz structs in and 8 of every field out
+    Benchmark::Run<TRegisters<Simd::int32_8, 3>>("Deinterleave", "3 x int32_8", "simd", 24, MakeRegisters<Simd::int32_8, 3>, [](const TRegisters<Simd::int32_8, 3>& X)
+    {
+        Simd::int32_8 Fields[3];
+        Simd::Deinterleave(X.Rows, Fields);
+        return CombineRows(Fields);
+    });
+
+    Benchmark::Run<TRegisters<Simd::int32_8, 3>>("Interleave", "3 x int32_8", "simd", 24, MakeRegisters<Simd::int32_8, 3>, [](const TRegisters<Simd::int32_8, 3>& X)
+    {
+        Simd::int32_8 Structs[3];
+        Simd::Interleave(X.Rows, Structs);
+        return CombineRows(Structs);
+    });
+
+    //two 4x4 matrices, one in each 128 bit half
+    Benchmark::Run<TRegisters<Simd::int32_8, 4>>("Transpose4x4", "4 x int32_8", "simd", 32, MakeRegisters<Simd::int32_8, 4>, [](const TRegisters<Simd::int32_8, 4>& X)
+    {
+        TRegisters<Simd::int32_8, 4> Transposed{X};
+        Simd::Transpose4x4(Transposed.Rows);
+        return CombineRows(Transposed.Rows);
+    });
+
+    Benchmark::Run<TRegisters<Simd::int32_8, 8>>("Transpose8x8", "8 x int32_8", "simd", 64, MakeRegisters<Simd::int32_8, 8>, [](const TRegisters<Simd::int32_8, 8>& X)
+    {
+        TRegisters<Simd::int32_8, 8> Transposed{X};
+        Simd::Transpose8x8(Transposed.Rows);
+        return CombineRows(Transposed.Rows);
+    });
+
+    //the cost of clearing the upper halves or all registers between two calls, the input only carries the latency chain
+    Benchmark::Run<uint64>("ZeroUpper", "vzeroupper", "simd", 1, MakeInput<uint64>, [](const uint64 X)
+    {
+        Simd::ZeroUpper();
+        return X;
+    });
+
+    Benchmark::Run<uint64>("ZeroAll", "vzeroall", "simd", 1, MakeInput<uint64>, [](const uint64 X)
+    {
+        Simd::ZeroAll();
+        return X;
+    });
+
+    Simd::FRandom Random{42};
+    std::mt19937_64 StandardRandom{42};
+
+    Benchmark::Run<uint64>("Random", "uint64_4", "simd", 4, MakeInput<uint64>, [&](const uint64)
+    {
+        return Random.Next();
+    });
+    Benchmark::Run<uint64>("Random", "uint64_4", "std", 1, MakeInput<uint64>, [&](const uint64)
+    {
+        return StandardRandom();
+    });
+
+    //Load is an unaligned read at any offset, the scalar side reads the same bytes a word at a time
+    RunBuffer("Load", "4096 bytes", "simd", BufferSize, [](const uint64 Offset)
+    {
+        Simd::uint8_32 Total{};
+        for(uint64 Index{0}; Index < BufferSize; Index += Simd::uint8_32::NumElements)
+        {
+            Total ^= Simd::Load<Simd::uint8_32>(Buffer + Offset + Index);
+        }
+        return Total;
+    });
+    RunBuffer("Load", "4096 bytes", "scalar", BufferSize, [](const uint64 Offset)
+    {
+        uint64 Total{0};
+        for(uint64 Index{0}; Index < BufferSize; Index += sizeof(uint64))
+        {
+            uint64 Word;
+            Memory::Copy(&Word, Buffer + Offset + Index, sizeof(Word));
+            Total ^= Word;
+        }
+        return Total;
+    });
+
+    RunBuffer("PopCount", "4096 bytes", "simd", BufferSize, [](const uint64 Offset)
+    {
+        return Simd::PopCount(Buffer + Offset, BufferSize);
+    });
+    RunBuffer("PopCount", "4096 bytes", "std", BufferSize, [](const uint64 Offset)
+    {
+        uint64 Total{0};
+        for(uint64 Index{0}; Index < BufferSize; Index += sizeof(uint64))
+        {
+            uint64 Word;
+            Memory::Copy(&Word, Buffer + Offset + Index, sizeof(Word));
+            Total += std::popcount(Word);
+        }
+        return Total;
+    });
+
+    for(const uint64 Size : {16ull, 4096ull})
+    {
+        const char8* Name{Size == 16 ? "16 bytes" : "4096 bytes"};
+
+        RunBuffer("Hash64", Name, "simd", Size, [Size](const uint64 Offset)
+        {
+            return Simd::Hash64(Buffer + Offset, Size);
+        });
+        RunBuffer("Hash64", Name, "std", Size, [Size](const uint64 Offset)
+        {
+            return std::hash<std::string_view>{}(std::string_view{reinterpret_cast<const char8*>(Buffer + Offset), Size});
+        });
+    }
+
+    RunBuffer("Crc32C", "4096 bytes", "simd", BufferSize, [](const uint64 Offset)
+    {
+        return Simd::Crc32C(Buffer + Offset, BufferSize);
+    });
+    RunBuffer("Crc32C", "4096 bytes", "scalar", BufferSize, [](const uint64 Offset)
+    {
+        return Crc32CSerial(Buffer + Offset, BufferSize);
+    });
+}
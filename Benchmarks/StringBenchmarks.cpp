@@ -0,0 +1,247 @@
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include "Benchmark.h"
+#include "../Encoding.h"
+#include "../String.h"
+
+namespace
+{
+    constexpr const char8* Words[8]
+    {
+        "static string",
+        "hello world",
+        "a",
+        "vector register comparisons",
+        "Benchmark",
+        "0123456789",
+        "the quick brown fox jumps",
+        "simd"
+    };
+
+    constexpr uint64 NumBytes{3072};
+
+    alignas(64) uint8 Bytes[NumBytes + 64];
+    alignas(64) char8 Text[NumBytes * 2 + 64];
+    alignas(64) uint8 Decoded[NumBytes * 2 + 64];
+
+    constexpr char8 Base64Digits[]{"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"};
+
+    //the textbook loop, three bytes to four characters, Size is a multiple of 3
+    uint64 Base64EncodeScalar(const uint8* Data, const uint64 Size, char8* Out)
+    {
+        uint64 OutIndex{0};
+        for(uint64 Index{0}; Index < Size; Index += 3)
+        {
+            const uint32 Triple{static_cast<uint32>(Data[Index]) << 16 | static_cast<uint32>(Data[Index + 1]) << 8 | Data[Index + 2]};
+
+            Out[OutIndex++] = Base64Digits[(Triple >> 18) & 63];
+            Out[OutIndex++] = Base64Digits[(Triple >> 12) & 63];
+            Out[OutIndex++] = Base64Digits[(Triple >> 6) & 63];
+            Out[OutIndex++] = Base64Digits[Triple & 63];
+        }
+        return OutIndex;
+    }
+
+    void HexEncodeScalar(const uint8* Data, const uint64 Size, char8* Out)
+    {
+        constexpr char8 HexDigits[]{"0123456789abcdef"};
+
+        for(uint64 Index{0}; Index < Size; ++Index)
+        {
+            Out[Index * 2] = HexDigits[Data[Index] >> 4];
+            Out[Index * 2 + 1] = HexDigits[Data[Index] & 15];
+        }
+    }
+
+    FStaticString MakeStaticString(const uint64 Index)
+    {
+        return FStaticString::MakeFromRaw(Words[Index % 8]);
+    }
+
+    std::string_view MakeView(const uint64 Index)
+    {
+        return std::string_view{Words[Index % 8]};
+    }
+
+    const char8* MakeRaw(const uint64 Index)
+    {
+        return Words[Index % 8];
+    }
+
+    template<typename TStep>
+    void RunBuffer(const char8* Group, const char8* Variant, const uint64 Size, TStep Step)
+    {
+        Benchmark::Run<uint64>(Group, "3072 bytes", Variant, Size, [](const uint64 Index)
+        {
+            return (Index * 0x9E3779B97F4A7C15ull >> 40) & 63;
+        }, Step);
+    }
+}
+
+void Benchmark::RunString()
+{
+    for(uint64 Index{0}; Index < sizeof(Bytes); ++Index)
+    {
+        Bytes[Index] = static_cast<uint8>(Index * 0x9E3779B97F4A7C15ull >> 56);
+    }
+
+    const FStaticString Needle{"hello world"};
+    const std::string_view NeedleView{"hello world"};
+
+    Benchmark::Run<FStaticString>("Equal", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [&](const FStaticString& String)
+    {
+        return String == Needle;
+    });
+    Benchmark::Run<std::string_view>("Equal", "FStaticString", "std", FStaticString::NumCharacters, MakeView, [&](const std::string_view String)
+    {
+        return String == NeedleView;
+    });
+
+    Benchmark::Run<FStaticString>("Length", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [](const FStaticString& String)
+    {
+        return String.Length();
+    });
+    Benchmark::Run<const char8*>("Length", "FStaticString", "scalar", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        return StringUtility::Length(String);
+    });
+    Benchmark::Run<const char8*>("Length", "FStaticString", "std", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        return std::strlen(String);
+    });
+
+    const FStaticString Part{"world"};
+    Benchmark::Run<FStaticString>("Contains", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [&](const FStaticString& String)
+    {
+        return String.Contains(Part);
+    });
+    Benchmark::Run<std::string_view>("Contains", "FStaticString", "std", FStaticString::NumCharacters, MakeView, [](const std::string_view String)
+    {
+        return String.find("world") != std::string_view::npos;
+    });
+
+    Benchmark::Run<FStaticString>("ToUppercase", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [](const FStaticString& String)
+    {
+        FStaticString Result{String};
+        return Result.ToUppercase();
+    });
+    Benchmark::Run<const char8*>("ToUppercase", "FStaticString", "std", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        char8 Result[FStaticString::NumCharacters]{};
+        for(uint64 Index{0}; String[Index] != NULL_CHAR; ++Index)
+        {
+            Result[Index] = static_cast<char8>(std::toupper(static_cast<uint8>(String[Index])));
+        }
+        return Result[0];
+    });
+
+    Benchmark::Run<const char8*>("MakeFromRaw", "FStaticString", "simd", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        return FStaticString::MakeFromRaw(String);
+    });
+    Benchmark::Run<const char8*>("MakeFromRaw", "FStaticString", "std", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        return std::string{String}.size();
+    });
+
+    Benchmark::Run<FStaticString>("ToLowercase", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [](const FStaticString& String)
+    {
+        FStaticString Result{String};
+        return Result.ToLowercase();
+    });
+    Benchmark::Run<const char8*>("ToLowercase", "FStaticString", "std", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        char8 Result[FStaticString::NumCharacters]{};
+        for(uint64 Index{0}; String[Index] != NULL_CHAR; ++Index)
+        {
+            Result[Index] = static_cast<char8>(std::tolower(static_cast<uint8>(String[Index])));
+        }
+        return Result[0];
+    });
+
+    Benchmark::Run<FStaticString>("Append", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [](const FStaticString& String)
+    {
+        FStaticString Result{"ab"};
+        return Result.Append(String);
+    });
+    Benchmark::Run<const char8*>("Append", "FStaticString", "std", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        std::string Result{"ab"};
+        Result.append(String);
+        return Result.size();
+    });
+
+    //PushBack puts the other string in front
+    Benchmark::Run<FStaticString>("PushBack", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [](const FStaticString& String)
+    {
+        FStaticString Result{"ab"};
+        return Result.PushBack(String);
+    });
+    Benchmark::Run<const char8*>("PushBack", "FStaticString", "std", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        std::string Result{"ab"};
+        Result.insert(0, String);
+        return Result.size();
+    });
+
+    Benchmark::Run<FStaticString>("RemoveFromEnd", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [](const FStaticString& String)
+    {
+        FStaticString Result{String};
+        Result.RemoveFromEnd(1);
+        return Result;
+    });
+    Benchmark::Run<const char8*>("RemoveFromEnd", "FStaticString", "std", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        std::string Result{String};
+        Result.pop_back();
+        return Result.size();
+    });
+
+    Benchmark::Run<FStaticString>("RemoveFromStart", "FStaticString", "simd", FStaticString::NumCharacters, MakeStaticString, [](const FStaticString& String)
+    {
+        FStaticString Result{String};
+        Result.RemoveFromStart(1);
+        return Result;
+    });
+    Benchmark::Run<const char8*>("RemoveFromStart", "FStaticString", "std", FStaticString::NumCharacters, MakeRaw, [](const char8* String)
+    {
+        std::string Result{String};
+        Result.erase(0, 1);
+        return Result.size();
+    });
+
+    RunBuffer("Base64Encode", "simd", NumBytes, [](const uint64 Offset)
+    {
+        return StringUtility::Base64Encode(Bytes + Offset, NumBytes, Text, StringUtility::EBase64Alphabet::Standard);
+    });
+    RunBuffer("Base64Encode", "scalar", NumBytes, [](const uint64 Offset)
+    {
+        return Base64EncodeScalar(Bytes + Offset, NumBytes, Text);
+    });
+
+    const uint64 NumEncoded{StringUtility::Base64Encode(Bytes, NumBytes, Text, StringUtility::EBase64Alphabet::Standard)};
+    RunBuffer("Base64Decode", "simd", NumBytes, [NumEncoded](const uint64 Offset)
+    {
+        //the offset moves the output so the start of the text stays on a whole group of four
+        return StringUtility::Base64Decode(Text, NumEncoded, Decoded + Offset, StringUtility::EBase64Alphabet::Standard).NumBytes;
+    });
+
+    RunBuffer("HexEncode", "simd", NumBytes, [](const uint64 Offset)
+    {
+        StringUtility::HexEncode(Bytes + Offset, NumBytes, Text);
+        return Text[0];
+    });
+    RunBuffer("HexEncode", "scalar", NumBytes, [](const uint64 Offset)
+    {
+        HexEncodeScalar(Bytes + Offset, NumBytes, Text);
+        return Text[0];
+    });
+
+    StringUtility::HexEncode(Bytes, NumBytes, Text);
+    RunBuffer("HexDecode", "simd", NumBytes, [](const uint64 Offset)
+    {
+        return StringUtility::HexDecode(Text, NumBytes * 2, Decoded + Offset).NumBytes;
+    });
+}
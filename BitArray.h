@@ -0,0 +1,327 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "Simd.h"
+#include "Math.h"
+#include "PopCount.h"
+
+namespace Simd
+{
+
+    //Fixed size bit set stored in whole registers of 64 bit lanes. The logical operations and the counts run one register at a time,
+    //bits past Num are kept clear so they never show up in a count or the set bit iteration
+    template<typename TVector = uint64_4>
+    class TBitArray final
+    {
+    public:
+
+        static_assert(std::is_same_v<typename TVector::ElementType, uint64>, "stored as 64 bit words");
+
+        inline static const constinit uint64 NumWordBits{64};
+        inline static const constinit uint64 NumVectorWords{TVector::NumElements};
+
+        //Walks the set bits in increasing order with tzcnt to find the next one and blsr to clear it
+        class FSetBitIterator final
+        {
+        public:
+
+            INLINE FSetBitIterator(const uint64* InWords, const uint64 InNumWords, const uint64 InWordIndex)
+                : Words(InWords)
+                , NumWords(InNumWords)
+                , WordIndex(InWordIndex)
+                , Word(InWordIndex < InNumWords ? InWords[InWordIndex] : 0)
+            {
+                SkipEmptyWords();
+            }
+
+            INLINE uint64 operator*() const
+            {
+                return WordIndex * NumWordBits + __builtin_ctzll(Word);
+            }
+
+            INLINE FSetBitIterator& operator++()
+            {
+                Word &= Word - 1;
+                SkipEmptyWords();
+                return *this;
+            }
+
+            INLINE bool operator!=(const FSetBitIterator& Other) const
+            {
+                return WordIndex != Other.WordIndex || Word != Other.Word;
+            }
+
+        private:
+
+            INLINE void SkipEmptyWords()
+            {
+                while(Word == 0 && WordIndex < NumWords)
+                {
+                    ++WordIndex;
+                    Word = WordIndex < NumWords ? Words[WordIndex] : 0;
+                }
+            }
+
+            const uint64* Words;
+            uint64 NumWords;
+            uint64 WordIndex;
+            uint64 Word;
+        };
+
+        struct FSetBitRange final
+        {
+            INLINE FSetBitIterator begin() const
+            {
+                return FSetBitIterator{Words, NumWords, 0};
+            }
+
+            INLINE FSetBitIterator end() const
+            {
+                return FSetBitIterator{Words, NumWords, NumWords};
+            }
+
+            const uint64* Words;
+            uint64 NumWords;
+        };
+
+    public:
+
+        //All bits start clear
+        explicit TBitArray(const uint64 InNum);
+
+        ~TBitArray();
+
+        TBitArray(const TBitArray&) = delete;
+        TBitArray& operator=(const TBitArray&) = delete;
+
+        INLINE bool Get(const uint64 Index) const
+        {
+            return (Words[Index / NumWordBits] >> (Index % NumWordBits)) & 1;
+        }
+
+        INLINE void Set(const uint64 Index, const bool bValue)
+        {
+            const uint64 Bit{1ull << (Index % NumWordBits)};
+            Words[Index / NumWordBits] = bValue ? Words[Index / NumWordBits] | Bit : Words[Index / NumWordBits] & ~Bit;
+        }
+
+        //Writes the NumMaskBits low bits of a compare mask to the bits starting at First, like the int32 results of CompareGreater.
+        //First must be below Num, mask bits past Num are dropped
+        void SetMask(const uint64 First, const int32 Mask, const uint32 NumMaskBits);
+
+        //Writes one bit per lane of a vector comparison to the bits starting at First
+        template<typename TMaskVector>
+        void SetMask(const uint64 First, const Internal::TVectorMask<TMaskVector>& Mask);
+
+        void ClearAll();
+
+        TBitArray& operator&=(const TBitArray& Other);
+        TBitArray& operator|=(const TBitArray& Other);
+        TBitArray& operator^=(const TBitArray& Other);
+
+        //Clears every bit that is set in Other
+        TBitArray& AndNot(const TBitArray& Other);
+
+        uint64 PopCount() const;
+
+        //PopCount of this & Other without writing the intersection anywhere
+        uint64 AndPopCount(const TBitArray& Other) const;
+
+        //Iterates the indices of the set bits, for(const uint64 Index : Bits.SetBits())
+        INLINE FSetBitRange SetBits() const
+        {
+            return FSetBitRange{Words, NumVectors * NumVectorWords};
+        }
+
+        //Calls Function with the index of every set bit, the same walk as SetBits without the iterator state
+        template<typename TFunction>
+        void ForEachSetBit(TFunction Function) const;
+
+        INLINE uint64 Num() const
+        {
+            return NumBits;
+        }
+
+        INLINE const uint64* GetWords() const
+        {
+            return Words;
+        }
+
+    private:
+
+        ATTRAVX TVector LoadVector(const uint64 Index) const
+        {
+            return Load<TVector>(Words + Index * NumVectorWords);
+        }
+
+        ATTRAVX void StoreVector(const uint64 Index, const TVector& Vector)
+        {
+            Memory::Copy(Words + Index * NumVectorWords, Vector.ToPtr(), sizeof(TVector));
+        }
+
+        uint64* Words;
+
+        uint64 NumBits;
+        uint64 NumVectors;
+
+    };
+
+}
+
+template<typename TVector>
+Simd::TBitArray<TVector>::TBitArray(const uint64 InNum)
+    : NumBits(InNum)
+    , NumVectors((InNum + sizeof(TVector) * 8 - 1) / (sizeof(TVector) * 8))
+{
+    Words = Memory::AllocateAligned<alignof(TVector), uint64>(NumVectors * NumVectorWords);
+    ClearAll();
+}
+
+template<typename TVector>
+Simd::TBitArray<TVector>::~TBitArray()
+{
+    Memory::FreeAligned<alignof(TVector)>(Words);
+}
+
+template<typename TVector>
+void Simd::TBitArray<TVector>::SetMask(const uint64 First, const int32 Mask, const uint32 NumMaskBits)
+{
+    const uint64 Count{NumBits - First < NumMaskBits ? NumBits - First : NumMaskBits};
+    const uint64 Bits{static_cast<uint64>(static_cast<uint32>(Mask)) & ((1ull << Count) - 1)};
+
+    const uint64 WordIndex{First / NumWordBits};
+    const uint64 Offset{First % NumWordBits};
+
+    //a mask of at most 32 bits spans at most two words
+    Words[WordIndex] = (Words[WordIndex] & ~(((1ull << Count) - 1) << Offset)) | (Bits << Offset);
+
+    if(Offset + Count > NumWordBits)
+    {
+        const uint64 Spill{Offset + Count - NumWordBits};
+        Words[WordIndex + 1] = (Words[WordIndex + 1] & ~((1ull << Spill) - 1)) | (Bits >> (NumWordBits - Offset));
+    }
+}
+
+template<typename TVector>
+template<typename TMaskVector>
+void Simd::TBitArray<TVector>::SetMask(const uint64 First, const Internal::TVectorMask<TMaskVector>& Mask)
+{
+    using MaskType = Internal::TVectorMask<TMaskVector>;
+
+    if constexpr(MaskType::BitsPerLane == 2)
+    {
+        //pmovmskb gave two bits per 16 bit lane, pext keeps every other one
+        SetMask(First, static_cast<int32>(__builtin_ia32_pext_si(static_cast<uint32>(static_cast<int32>(Mask)), 0x55555555)), TMaskVector::NumElements);
+    }
+    else
+    {
+        SetMask(First, static_cast<int32>(Mask), TMaskVector::NumElements);
+    }
+}
+
+template<typename TVector>
+void Simd::TBitArray<TVector>::ClearAll()
+{
+    Memory::Set(Words, 0, NumVectors * sizeof(TVector));
+}
+
+template<typename TVector>
+Simd::TBitArray<TVector>& Simd::TBitArray<TVector>::operator&=(const TBitArray& Other)
+{
+    ASSERT(NumBits == Other.NumBits);
+
+    for(uint64 Index{0}; Index < NumVectors; ++Index)
+    {
+        StoreVector(Index, LoadVector(Index) & Other.LoadVector(Index));
+    }
+
+    return *this;
+}
+
+template<typename TVector>
+Simd::TBitArray<TVector>& Simd::TBitArray<TVector>::operator|=(const TBitArray& Other)
+{
+    ASSERT(NumBits == Other.NumBits);
+
+    for(uint64 Index{0}; Index < NumVectors; ++Index)
+    {
+        StoreVector(Index, LoadVector(Index) | Other.LoadVector(Index));
+    }
+
+    return *this;
+}
+
+template<typename TVector>
+Simd::TBitArray<TVector>& Simd::TBitArray<TVector>::operator^=(const TBitArray& Other)
+{
+    ASSERT(NumBits == Other.NumBits);
+
+    for(uint64 Index{0}; Index < NumVectors; ++Index)
+    {
+        StoreVector(Index, LoadVector(Index) ^ Other.LoadVector(Index));
+    }
+
+    return *this;
+}
+
+template<typename TVector>
+Simd::TBitArray<TVector>& Simd::TBitArray<TVector>::AndNot(const TBitArray& Other)
+{
+    ASSERT(NumBits == Other.NumBits);
+
+    for(uint64 Index{0}; Index < NumVectors; ++Index)
+    {
+        //written as ~Other & This so it maps to a single vpandn
+        StoreVector(Index, TVector{~Other.LoadVector(Index).Vector & LoadVector(Index).Vector});
+    }
+
+    return *this;
+}
+
+template<typename TVector>
+uint64 Simd::TBitArray<TVector>::PopCount() const
+{
+    return PopCountVectors(NumVectors, [this](const uint64 Index)
+    {
+        return LoadVector(Index);
+    });
+}
+
+template<typename TVector>
+uint64 Simd::TBitArray<TVector>::AndPopCount(const TBitArray& Other) const
+{
+    ASSERT(NumBits == Other.NumBits);
+
+    return PopCountVectors(NumVectors, [this, &Other](const uint64 Index)
+    {
+        return LoadVector(Index) & Other.LoadVector(Index);
+    });
+}
+
+template<typename TVector>
+template<typename TFunction>
+void Simd::TBitArray<TVector>::ForEachSetBit(TFunction Function) const
+{
+    const uint64 NumWords{NumVectors * NumVectorWords};
+
+    for(uint64 WordIndex{0}; WordIndex < NumWords; ++WordIndex)
+    {
+        for(uint64 Word{Words[WordIndex]}; Word != 0; Word &= Word - 1)
+        {
+            Function(WordIndex * NumWordBits + __builtin_ctzll(Word));
+        }
+    }
+}
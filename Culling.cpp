@@ -0,0 +1,213 @@
+#include "Culling.h"
+#include "Math.h"
+
+namespace
+{
+    //compact table entry for every 8 bit mask, the positions of its set bits packed as nibbles from the lowest up
+    struct FCompactTable
+    {
+        uint32 Entries[256];
+    };
+
+    constexpr FCompactTable CompactTable = []() consteval -> FCompactTable
+    {
+        FCompactTable Table{};
+
+        for(uint32 Mask{0}; Mask < 256; ++Mask)
+        {
+            uint32 Slot{0};
+            for(uint32 Bit{0}; Bit < 8; ++Bit)
+            {
+                if(Mask & (1 << Bit))
+                {
+                    Table.Entries[Mask] |= Bit << (Slot * 4);
+                    ++Slot;
+                }
+            }
+        }
+
+        return Table;
+    }();
+
+    ATTRAVX int32 ValidLanes(const uint64 Num, const uint64 First)
+    {
+        return Num - First >= Simd::float32_8::NumElements ? Simd::float32_8::ComparisonMask : (1 << (Num - First)) - 1;
+    }
+
+    template<typename TChunkTest>
+    ATTRAVX uint64 CullChunks(const uint64 Num, uint32* Out, TChunkTest ChunkTest)
+    {
+        uint64 NumVisible{0};
+
+        for(uint64 First{0}; First < Num; First += Simd::float32_8::NumElements)
+        {
+            NumVisible += Culling::CompactIndices(ChunkTest(First), static_cast<uint32>(First), Out + NumVisible);
+        }
+
+        return NumVisible;
+    }
+}
+
+int32 Culling::FrustumBoxes(const FFrustum& Frustum, const FBoxArray& Boxes, const uint64 First)
+{
+    const Simd::float32_8 CenterX{Simd::LoadChunk<Simd::float32_8>(Boxes.CenterX, Boxes.Num, First)};
+    const Simd::float32_8 CenterY{Simd::LoadChunk<Simd::float32_8>(Boxes.CenterY, Boxes.Num, First)};
+    const Simd::float32_8 CenterZ{Simd::LoadChunk<Simd::float32_8>(Boxes.CenterZ, Boxes.Num, First)};
+    const Simd::float32_8 ExtentX{Simd::LoadChunk<Simd::float32_8>(Boxes.ExtentX, Boxes.Num, First)};
+    const Simd::float32_8 ExtentY{Simd::LoadChunk<Simd::float32_8>(Boxes.ExtentY, Boxes.Num, First)};
+    const Simd::float32_8 ExtentZ{Simd::LoadChunk<Simd::float32_8>(Boxes.ExtentZ, Boxes.Num, First)};
+
+    int32 Outside{0};
+
+    for(const FVector4& Plane : Frustum.Planes)
+    {
+        //the box is outside when even its corner furthest along the normal is behind the plane
+        const Simd::float32_8 Distance{CenterX * Simd::float32_8{Plane.X()} + CenterY * Simd::float32_8{Plane.Y()} + CenterZ * Simd::float32_8{Plane.Z()} + Simd::float32_8{Plane.W()}};
+        const Simd::float32_8 Radius{ExtentX * Simd::float32_8{__builtin_fabsf(Plane.X())} + ExtentY * Simd::float32_8{__builtin_fabsf(Plane.Y())} + ExtentZ * Simd::float32_8{__builtin_fabsf(Plane.Z())}};
+
+        Outside |= Simd::CompareLesser(Distance + Radius, Simd::float32_8{0.f});
+    }
+
+    return ~Outside & ValidLanes(Boxes.Num, First);
+}
+
+int32 Culling::FrustumSpheres(const FFrustum& Frustum, const FSphereArray& Spheres, const uint64 First)
+{
+    const Simd::float32_8 X{Simd::LoadChunk<Simd::float32_8>(Spheres.X, Spheres.Num, First)};
+    const Simd::float32_8 Y{Simd::LoadChunk<Simd::float32_8>(Spheres.Y, Spheres.Num, First)};
+    const Simd::float32_8 Z{Simd::LoadChunk<Simd::float32_8>(Spheres.Z, Spheres.Num, First)};
+    const Simd::float32_8 Radius{Simd::LoadChunk<Simd::float32_8>(Spheres.Radius, Spheres.Num, First)};
+
+    int32 Outside{0};
+
+    for(const FVector4& Plane : Frustum.Planes)
+    {
+        const Simd::float32_8 Distance{X * Simd::float32_8{Plane.X()} + Y * Simd::float32_8{Plane.Y()} + Z * Simd::float32_8{Plane.Z()} + Simd::float32_8{Plane.W()}};
+
+        Outside |= Simd::CompareLesser(Distance + Radius, Simd::float32_8{0.f});
+    }
+
+    return ~Outside & ValidLanes(Spheres.Num, First);
+}
+
+int32 Culling::RayBoxes(const FRay& Ray, const FBoxArray& Boxes, const uint64 First)
+{
+    const float32* Centers[3]{Boxes.CenterX, Boxes.CenterY, Boxes.CenterZ};
+    const float32* Extents[3]{Boxes.ExtentX, Boxes.ExtentY, Boxes.ExtentZ};
+
+    Simd::float32_8 Near{0.f};
+    Simd::float32_8 Far{Ray.MaxDistance};
+
+    for(int32 Axis{0}; Axis < 3; ++Axis)
+    {
+        const Simd::float32_8 Origin{Ray.Origin.Vector[Axis]};
+        const Simd::float32_8 InverseDirection{1.f / Ray.Direction.Vector[Axis]};
+
+        const Simd::float32_8 Center{Simd::LoadChunk<Simd::float32_8>(Centers[Axis], Boxes.Num, First)};
+        const Simd::float32_8 Extent{Simd::LoadChunk<Simd::float32_8>(Extents[Axis], Boxes.Num, First)};
+
+        const Simd::float32_8 Entry{(Center - Extent - Origin) * InverseDirection};
+        const Simd::float32_8 Exit{(Center + Extent - Origin) * InverseDirection};
+
+        Near = Simd::MakeFromGreater(Near, Simd::MakeFromLesser(Entry, Exit));
+        Far = Simd::MakeFromLesser(Far, Simd::MakeFromGreater(Entry, Exit));
+    }
+
+    return Simd::CompareLesserOrEqual(Near, Far) & ValidLanes(Boxes.Num, First);
+}
+
+int32 Culling::RaySpheres(const FRay& Ray, const FSphereArray& Spheres, const uint64 First)
+{
+    const float32* Centers[3]{Spheres.X, Spheres.Y, Spheres.Z};
+
+    Simd::float32_8 Offsets[3];
+    Simd::float32_8 Projection{0.f};
+
+    for(int32 Axis{0}; Axis < 3; ++Axis)
+    {
+        Offsets[Axis] = Simd::LoadChunk<Simd::float32_8>(Centers[Axis], Spheres.Num, First) - Simd::float32_8{Ray.Origin.Vector[Axis]};
+        Projection += Offsets[Axis] * Simd::float32_8{Ray.Direction.Vector[Axis]};
+    }
+
+    //the ray parameter of the closest point, clamped to the segment
+    const Simd::float32_8 Closest{Simd::MakeFromLesser(Simd::MakeFromGreater(Projection / Simd::float32_8{Ray.Direction.Dot3(Ray.Direction)}, Simd::float32_8{0.f}), Simd::float32_8{Ray.MaxDistance})};
+
+    Simd::float32_8 DistanceSquared{0.f};
+    for(int32 Axis{0}; Axis < 3; ++Axis)
+    {
+        const Simd::float32_8 Delta{Offsets[Axis] - Closest * Simd::float32_8{Ray.Direction.Vector[Axis]}};
+        DistanceSquared += Delta * Delta;
+    }
+
+    const Simd::float32_8 Radius{Simd::LoadChunk<Simd::float32_8>(Spheres.Radius, Spheres.Num, First)};
+
+    return Simd::CompareLesserOrEqual(DistanceSquared, Radius * Radius) & ValidLanes(Spheres.Num, First);
+}
+
+int32 Culling::BoxBoxes(const FVector4& Center, const FVector4& Extent, const FBoxArray& Boxes, const uint64 First)
+{
+    const float32* Centers[3]{Boxes.CenterX, Boxes.CenterY, Boxes.CenterZ};
+    const float32* Extents[3]{Boxes.ExtentX, Boxes.ExtentY, Boxes.ExtentZ};
+
+    int32 Separated{0};
+
+    for(int32 Axis{0}; Axis < 3; ++Axis)
+    {
+        const Simd::float32_8 Offset{Simd::LoadChunk<Simd::float32_8>(Centers[Axis], Boxes.Num, First) - Simd::float32_8{Center.Vector[Axis]}};
+        const Simd::float32_8 Reach{Simd::LoadChunk<Simd::float32_8>(Extents[Axis], Boxes.Num, First) + Simd::float32_8{Extent.Vector[Axis]}};
+
+        //|Offset| > Reach without an absolute value
+        Separated |= Simd::CompareGreater(Offset, Reach) | Simd::CompareLesser(Offset, Simd::float32_8{0.f} - Reach);
+    }
+
+    return ~Separated & ValidLanes(Boxes.Num, First);
+}
+
+int32 Culling::BoxSpheres(const FVector4& Center, const FVector4& Extent, const FSphereArray& Spheres, const uint64 First)
+{
+    const float32* Centers[3]{Spheres.X, Spheres.Y, Spheres.Z};
+
+    Simd::float32_8 DistanceSquared{0.f};
+
+    for(int32 Axis{0}; Axis < 3; ++Axis)
+    {
+        const Simd::float32_8 Offset{Simd::LoadChunk<Simd::float32_8>(Centers[Axis], Spheres.Num, First) - Simd::float32_8{Center.Vector[Axis]}};
+        const Simd::float32_8 BoxExtent{Extent.Vector[Axis]};
+
+        //how far the sphere center lies outside the box along this axis, 0 when it is within the slab
+        const Simd::float32_8 Outside{Simd::MakeFromGreater(Simd::MakeFromGreater(Offset - BoxExtent, Simd::float32_8{0.f} - Offset - BoxExtent), Simd::float32_8{0.f})};
+        DistanceSquared += Outside * Outside;
+    }
+
+    const Simd::float32_8 Radius{Simd::LoadChunk<Simd::float32_8>(Spheres.Radius, Spheres.Num, First)};
+
+    return Simd::CompareLesserOrEqual(DistanceSquared, Radius * Radius) & ValidLanes(Spheres.Num, First);
+}
+
+uint64 Culling::CompactIndices(const int32 Mask, const uint32 First, uint32* Out)
+{
+    const uint8 ChunkMask{static_cast<uint8>(Mask)};
+
+    const Simd::uint32_8 Packed{CompactTable.Entries[ChunkMask]};
+    const Simd::uint32_8 Indices{((Packed.Vector >> Simd::uint32_8{0, 4, 8, 12, 16, 20, 24, 28}.Vector) & 0xF) + First};
+
+    Memory::Copy(Out, Indices.ToPtr(), sizeof(Indices));
+
+    return Math::NumActiveBits(static_cast<uint32>(ChunkMask));
+}
+
+uint64 Culling::CullBoxes(const FFrustum& Frustum, const FBoxArray& Boxes, uint32* Out)
+{
+    return CullChunks(Boxes.Num, Out, [&](const uint64 First)
+    {
+        return FrustumBoxes(Frustum, Boxes, First);
+    });
+}
+
+uint64 Culling::CullSpheres(const FFrustum& Frustum, const FSphereArray& Spheres, uint32* Out)
+{
+    return CullChunks(Spheres.Num, Out, [&](const uint64 First)
+    {
+        return FrustumSpheres(Frustum, Spheres, First);
+    });
+}
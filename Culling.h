@@ -0,0 +1,81 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "VectorMath.h"
+
+//axis aligned boxes as structure of arrays in center / half extent form, every array holds Num floats
+struct FBoxArray final
+{
+    const float32* CenterX;
+    const float32* CenterY;
+    const float32* CenterZ;
+    const float32* ExtentX;
+    const float32* ExtentY;
+    const float32* ExtentZ;
+    uint64 Num;
+};
+
+//spheres as structure of arrays, every array holds Num floats
+struct FSphereArray final
+{
+    const float32* X;
+    const float32* Y;
+    const float32* Z;
+    const float32* Radius;
+    uint64 Num;
+};
+
+//six planes stored as (Normal, Distance) with the normals pointing inwards, a point P is inside a plane when Dot3(Normal, P) + Distance >= 0
+struct FFrustum final
+{
+    FVector4 Planes[6];
+};
+
+struct FRay final
+{
+    FVector4 Origin;
+    FVector4 Direction;
+    float32 MaxDistance;
+};
+
+//The chunk tests check the 8 shapes starting at First and return one bit per shape, set when it intersects.
+//Bits past the end of the arrays are always clear
+namespace Culling
+{
+
+    int32 FrustumBoxes(const FFrustum& Frustum, const FBoxArray& Boxes, const uint64 First);
+
+    int32 FrustumSpheres(const FFrustum& Frustum, const FSphereArray& Spheres, const uint64 First);
+
+    //slab test, a hit counts when the ray enters the box between its origin and MaxDistance
+    int32 RayBoxes(const FRay& Ray, const FBoxArray& Boxes, const uint64 First);
+
+    //a hit counts when the point of the ray closest to the center, taken between its origin and MaxDistance, lies within the radius
+    int32 RaySpheres(const FRay& Ray, const FSphereArray& Spheres, const uint64 First);
+
+    int32 BoxBoxes(const FVector4& Center, const FVector4& Extent, const FBoxArray& Boxes, const uint64 First);
+
+    int32 BoxSpheres(const FVector4& Center, const FVector4& Extent, const FSphereArray& Spheres, const uint64 First);
+
+    //Writes First plus the position of every set bit in Mask to Out and returns how many were written.
+    //Always stores a whole register, so Out needs room for 8 indices
+    uint64 CompactIndices(const int32 Mask, const uint32 First, uint32* Out);
+
+    //Runs the chunk test over the whole array and compacts the result into the indices of the visible shapes, returns their count.
+    //Out must hold Num rounded up to a multiple of 8
+    uint64 CullBoxes(const FFrustum& Frustum, const FBoxArray& Boxes, uint32* Out);
+    uint64 CullSpheres(const FFrustum& Frustum, const FSphereArray& Spheres, uint32* Out);
+
+}
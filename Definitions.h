@@ -31,6 +31,10 @@ using float32 = float;
 using float64 = double;
 using float128 = long double;
 
+//storage types, F16C converts float16 in hardware and bfloat16 is the upper half of a float32
+using float16 = _Float16;
+using bfloat16 = __bf16;
+
 #define ATTRINLINE __attribute__((always_inline))
 #define INLINE inline ATTRINLINE
 #define EXPECT(cond, tf) (__builtin_expect((cond), tf))
@@ -0,0 +1,130 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Simd.h"
+
+namespace Simd
+{
+
+    //Integer division of every lane by one divisor known only at runtime. x86 has no vector integer divide, so the constructor
+    //turns the divisor into a magic multiplier and shifts (Granlund and Montgomery) and Divide is a multiply high plus a few adds and shifts.
+    //The same instructions run for every divisor, including 1 and powers of two, so there are no branches per call
+    template<typename TVector>
+    class TDivider final
+    {
+    public:
+
+        using ElementType = typename TVector::ElementType;
+
+        static_assert(std::is_integral_v<ElementType> && ElementSize<TVector>() >= 2, "needs 16, 32 or 64 bit integer lanes");
+
+        inline static const constinit int32 LaneBits{static_cast<int32>(ElementSize<TVector>() * 8)};
+
+        //Value must not be 0
+        explicit TDivider(const ElementType Value);
+
+        //Rounds towards zero like the scalar operator/, dividing the lowest signed value by -1 wraps
+        ATTRAVX TVector Divide(const TVector& Dividend) const;
+
+        //Dividend - Divide(Dividend) * Divisor, takes the sign of Dividend like the scalar operator%
+        ATTRAVX TVector Remainder(const TVector& Dividend) const;
+
+        inline ElementType GetDivisor() const
+        {
+            return Divisor[0];
+        }
+
+    private:
+
+        TVector Magic;
+        TVector Divisor;
+
+        //the sign of the divisor in every bit, 0 for unsigned lanes
+        TVector DivisorSign;
+
+        int32 PreShift;
+        int32 PostShift;
+
+    };
+
+    template<typename TVector>
+    ATTRAVX TVector operator/(const TVector& Dividend, const TDivider<TVector>& Divider)
+    {
+        return Divider.Divide(Dividend);
+    }
+
+    template<typename TVector>
+    ATTRAVX TVector operator%(const TVector& Dividend, const TDivider<TVector>& Divider)
+    {
+        return Divider.Remainder(Dividend);
+    }
+
+}
+
+template<typename TVector>
+Simd::TDivider<TVector>::TDivider(const ElementType Value)
+    : Divisor(Value)
+    , DivisorSign(static_cast<ElementType>(std::is_signed_v<ElementType> && Value < ElementType{0} ? -1 : 0))
+{
+    using UnsignedType = std::make_unsigned_t<ElementType>;
+
+    const UnsignedType AbsoluteDivisor{std::is_signed_v<ElementType> && Value < ElementType{0} ? static_cast<UnsignedType>(0 - static_cast<UnsignedType>(Value)) : static_cast<UnsignedType>(Value)};
+
+    //ceil(log2(AbsoluteDivisor))
+    const int32 Log{AbsoluteDivisor == 1 ? 0 : 64 - __builtin_clzll(static_cast<uint64>(AbsoluteDivisor - 1))};
+
+    if constexpr(std::is_signed_v<ElementType>)
+    {
+        //1 + 2^(N + L - 1) / |d| lies in (2^(N - 1), 2^N], stored minus 2^N so it fits the signed lane
+        const int32 RoundedLog{Log > 0 ? Log : 1};
+        const uint128 Multiplier{1 + (static_cast<uint128>(1) << (LaneBits + RoundedLog - 1)) / AbsoluteDivisor};
+
+        Magic = TVector{static_cast<ElementType>(static_cast<UnsignedType>(Multiplier))};
+        PreShift = 0;
+        PostShift = RoundedLog - 1;
+    }
+    else if constexpr(!std::is_signed_v<ElementType>)
+    {
+        //2^N * (2^L - d) / d + 1 is below 2^N, the missing 2^N of the multiplier is added back through the dividend
+        const uint128 Multiplier{((((static_cast<uint128>(1) << Log) - AbsoluteDivisor) << LaneBits) / AbsoluteDivisor) + 1};
+
+        Magic = TVector{static_cast<ElementType>(Multiplier)};
+        PreShift = Log < 1 ? Log : 1;
+        PostShift = Log > 1 ? Log - 1 : 0;
+    }
+}
+
+template<typename TVector>
+ATTRAVX TVector Simd::TDivider<TVector>::Divide(const TVector& Dividend) const
+{
+    const TVector High{MultiplyHigh(Magic, Dividend)};
+
+    if constexpr(std::is_signed_v<ElementType>)
+    {
+        const TVector Quotient{ShiftRightBits(Dividend + High, PostShift) - ShiftRightBits<LaneBits - 1>(Dividend)};
+
+        return (Quotient ^ DivisorSign) - DivisorSign;
+    }
+    else if constexpr(!std::is_signed_v<ElementType>)
+    {
+        return ShiftRightBits(High + ShiftRightBits(Dividend - High, PreShift), PostShift);
+    }
+}
+
+template<typename TVector>
+ATTRAVX TVector Simd::TDivider<TVector>::Remainder(const TVector& Dividend) const
+{
+    return Dividend - Divide(Dividend) * Divisor;
+}
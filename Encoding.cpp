@@ -0,0 +1,379 @@
+#include "Encoding.h"
+
+namespace
+{
+    constexpr uint8 InvalidValue{0xFF};
+
+    //Everything one base64 alphabet needs, derived from its 64 characters at compile time.
+    //The vector decoder validates with two pshufb bit class lookups (Mula and Lemire): every high nibble gets one class bit
+    //and every low nibble the bits of the classes it is not valid in, so a character is invalid when the two lookups overlap
+    struct FBase64Tables final
+    {
+        char8 Characters[64];
+        uint8 Values[256];
+
+        //added to the reduced 6 bit index, see EncodeBlock
+        uint8 EncodeShift[16];
+
+        uint8 DecodeLow[16];
+        uint8 DecodeHigh[16];
+
+        //added to a character to get its value, by high nibble. The 63rd character shares its nibble with others so it is special cased
+        uint8 DecodeOffset[16];
+        char8 Special;
+    };
+
+    consteval FBase64Tables MakeBase64Tables(const char8 (&Characters)[65])
+    {
+        FBase64Tables Tables{};
+
+        for(uint32 Index{0}; Index < 256; ++Index)
+        {
+            Tables.Values[Index] = InvalidValue;
+        }
+
+        for(uint8 Value{0}; Value < 64; ++Value)
+        {
+            Tables.Characters[Value] = Characters[Value];
+            Tables.Values[static_cast<uint8>(Characters[Value])] = Value;
+        }
+
+        //the reduced index is 13 for 0 - 25, 0 for 26 - 51 and 1 to 12 for 52 - 63
+        Tables.EncodeShift[13] = static_cast<uint8>(Characters[0]);
+        Tables.EncodeShift[0] = static_cast<uint8>(Characters[26] - 26);
+        for(uint8 Reduced{1}; Reduced <= 12; ++Reduced)
+        {
+            Tables.EncodeShift[Reduced] = static_cast<uint8>(Characters[51 + Reduced] - (51 + Reduced));
+        }
+
+        uint16 ValidLowNibbles[16]{};
+        for(uint8 Value{0}; Value < 64; ++Value)
+        {
+            const uint8 Character{static_cast<uint8>(Characters[Value])};
+            ValidLowNibbles[Character >> 4] |= 1 << (Character & 0x0F);
+        }
+
+        //high nibbles with the same valid low nibbles share a class, both alphabets need fewer than the 8 bits available
+        uint16 Classes[16]{};
+        uint32 NumClasses{0};
+        for(uint32 High{0}; High < 16; ++High)
+        {
+            uint32 Class{0};
+            while(Class < NumClasses && Classes[Class] != ValidLowNibbles[High])
+            {
+                ++Class;
+            }
+
+            if(Class == NumClasses)
+            {
+                Classes[NumClasses++] = ValidLowNibbles[High];
+            }
+
+            Tables.DecodeHigh[High] = static_cast<uint8>(1 << Class);
+        }
+
+        for(uint32 Low{0}; Low < 16; ++Low)
+        {
+            for(uint32 Class{0}; Class < NumClasses; ++Class)
+            {
+                Tables.DecodeLow[Low] |= (Classes[Class] >> Low) & 1 ? 0 : static_cast<uint8>(1 << Class);
+            }
+        }
+
+        Tables.Special = Characters[63];
+        for(uint8 Value{0}; Value < 63; ++Value)
+        {
+            const uint8 Character{static_cast<uint8>(Characters[Value])};
+            Tables.DecodeOffset[Character >> 4] = static_cast<uint8>(Value - Character);
+        }
+
+        return Tables;
+    }
+
+    constexpr FBase64Tables StandardTables{MakeBase64Tables("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/")};
+    constexpr FBase64Tables UrlSafeTables{MakeBase64Tables("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_")};
+
+    INLINE const FBase64Tables& GetTables(const StringUtility::EBase64Alphabet Alphabet)
+    {
+        return Alphabet == StringUtility::EBase64Alphabet::Standard ? StandardTables : UrlSafeTables;
+    }
+
+    INLINE Simd::Internal::uint8_16 MakeTable(const uint8 (&Entries)[16])
+    {
+        return __builtin_bit_cast(Simd::Internal::uint8_16, Entries);
+    }
+
+    //24 bytes into 32 characters. Each 128 bit half takes 12 bytes and spreads every 3 byte group over a 32 bit lane, the multiplies
+    //move the four 6 bit fields into separate bytes and a pshufb lookup turns the index range into the offset to the character
+    ATTRAVX Simd::uint8_32 EncodeBlock(const uint8* Data, const FBase64Tables& Tables)
+    {
+        const Simd::Internal::uint8_16 Low{Simd::Load<Simd::uint8_16>(Data).Vector};
+        const Simd::Internal::uint8_16 High{Simd::Load<Simd::uint8_16>(Data + 12).Vector};
+
+        const Simd::uint16_16 Groups{Simd::Reinterpret<Simd::uint16_16>(Simd::uint8_32{__builtin_shufflevector(Low, High,
+            1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+            17, 16, 18, 17, 20, 19, 21, 20, 23, 22, 24, 23, 26, 25, 27, 26)})};
+
+        const Simd::uint16_16 Outer{Simd::MultiplyHigh(Groups & Simd::Reinterpret<Simd::uint16_16>(Simd::uint32_8{0x0FC0FC00u}), Simd::Reinterpret<Simd::uint16_16>(Simd::uint32_8{0x04000040u}))};
+        const Simd::uint16_16 Inner{(Groups & Simd::Reinterpret<Simd::uint16_16>(Simd::uint32_8{0x003F03F0u})) * Simd::Reinterpret<Simd::uint16_16>(Simd::uint32_8{0x01000010u})};
+
+        const Simd::uint8_32 Indices{Simd::Reinterpret<Simd::uint8_32>(Outer | Inner)};
+
+        const Simd::Internal::uint8_32 Reduced{Simd::SubtractSaturate(Indices, Simd::uint8_32{static_cast<uint8>(51)}).Vector | (reinterpret_cast<Simd::Internal::uint8_32>(Indices.Vector < 26) & 13)};
+
+        return Simd::uint8_32{Simd::Internal::LookupNibbles(MakeTable(Tables.EncodeShift), Reduced) + Indices.Vector};
+    }
+
+    //32 characters into 24 bytes in the low lanes, Invalid gets a bit for every character outside the alphabet
+    ATTRAVX Simd::uint8_32 DecodeBlock(const char8* Text, const FBase64Tables& Tables, int32& Invalid)
+    {
+        const Simd::uint8_32 Characters{Simd::Load<Simd::uint8_32>(reinterpret_cast<const uint8*>(Text))};
+
+        const Simd::Internal::uint8_32 High{Characters.Vector >> 4};
+        const Simd::Internal::uint8_32 Low{Characters.Vector & 0x0F};
+
+        const Simd::uint8_32 Overlap{Simd::Internal::LookupNibbles(MakeTable(Tables.DecodeLow), Low) & Simd::Internal::LookupNibbles(MakeTable(Tables.DecodeHigh), High)};
+        Invalid = static_cast<int32>(Overlap != Simd::uint8_32{});
+
+        const Simd::uint8_32 Values{Simd::Select(Characters == Simd::uint8_32{static_cast<uint8>(Tables.Special)}, Simd::uint8_32{static_cast<uint8>(63)},
+                                                 Simd::uint8_32{Characters.Vector + Simd::Internal::LookupNibbles(MakeTable(Tables.DecodeOffset), High)})};
+
+        //a << 6 | b and c << 6 | d in 16 bit lanes, then ab << 12 | cd in 32 bit lanes, leaving 3 bytes per lane in reverse order
+        const Simd::int16_16 Pairs{Simd::MultiplyAddPairsSaturate(Values, Simd::Reinterpret<Simd::int8_32>(Simd::uint32_8{0x01400140u}))};
+        const Simd::uint8_32 Triples{Simd::Reinterpret<Simd::uint8_32>(Simd::MultiplyAddPairs(Pairs, Simd::Reinterpret<Simd::int16_16>(Simd::uint32_8{0x00011000u})))};
+
+        return Simd::uint8_32{__builtin_shufflevector(Triples.Vector, Triples.Vector,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, 18, 17, 16, 22, 21, 20, 26, 25, 24, 30, 29, 28,
+            -1, -1, -1, -1, -1, -1, -1, -1)};
+    }
+
+    INLINE uint8 HexValue(const char8 Character)
+    {
+        const uint8 Digit{static_cast<uint8>(Character - '0')};
+        const uint8 Letter{static_cast<uint8>((Character | 0x20) - 'a')};
+
+        return Digit < 10 ? Digit : Letter < 6 ? static_cast<uint8>(Letter + 10) : InvalidValue;
+    }
+}
+
+uint64 StringUtility::Base64EncodedSize(const uint64 NumBytes, const EBase64Alphabet Alphabet)
+{
+    return Alphabet == EBase64Alphabet::Standard ? (NumBytes + 2) / 3 * 4 : (NumBytes * 4 + 2) / 3;
+}
+
+uint64 StringUtility::Base64DecodedMaxSize(const uint64 NumCharacters)
+{
+    return (NumCharacters + 3) / 4 * 3;
+}
+
+uint64 StringUtility::Base64Encode(const uint8* Data, const uint64 NumBytes, char8* Out, const EBase64Alphabet Alphabet)
+{
+    const FBase64Tables& Tables{GetTables(Alphabet)};
+
+    uint64 Index{0};
+    uint64 OutIndex{0};
+
+    //the upper half reads 16 bytes from 12 in, so 4 bytes past the 24 that get encoded have to be readable
+    for(; Index + 28 <= NumBytes; Index += 24, OutIndex += 32)
+    {
+        const Simd::uint8_32 Characters{EncodeBlock(Data + Index, Tables)};
+        Memory::Copy(Out + OutIndex, Characters.ToPtr(), 32);
+    }
+
+    for(; Index + 3 <= NumBytes; Index += 3, OutIndex += 4)
+    {
+        const uint32 Group{static_cast<uint32>(Data[Index]) << 16 | static_cast<uint32>(Data[Index + 1]) << 8 | Data[Index + 2]};
+
+        Out[OutIndex] = Tables.Characters[Group >> 18];
+        Out[OutIndex + 1] = Tables.Characters[(Group >> 12) & 0x3F];
+        Out[OutIndex + 2] = Tables.Characters[(Group >> 6) & 0x3F];
+        Out[OutIndex + 3] = Tables.Characters[Group & 0x3F];
+    }
+
+    if(Index < NumBytes)
+    {
+        const bool bTwoBytes{Index + 1 < NumBytes};
+        const uint32 Group{static_cast<uint32>(Data[Index]) << 16 | (bTwoBytes ? static_cast<uint32>(Data[Index + 1]) << 8 : 0)};
+
+        Out[OutIndex++] = Tables.Characters[Group >> 18];
+        Out[OutIndex++] = Tables.Characters[(Group >> 12) & 0x3F];
+
+        if(bTwoBytes)
+        {
+            Out[OutIndex++] = Tables.Characters[(Group >> 6) & 0x3F];
+        }
+
+        if(Alphabet == EBase64Alphabet::Standard)
+        {
+            Out[OutIndex++] = '=';
+
+            if(!bTwoBytes)
+            {
+                Out[OutIndex++] = '=';
+            }
+        }
+    }
+
+    return OutIndex;
+}
+
+StringUtility::FDecodeResult StringUtility::Base64Decode(const char8* Text, const uint64 NumCharacters, uint8* Out, const EBase64Alphabet Alphabet)
+{
+    const FBase64Tables& Tables{GetTables(Alphabet)};
+
+    uint64 Length{NumCharacters};
+    uint64 NumPadding{0};
+    while(NumPadding < 2 && Length > 0 && Text[Length - 1] == '=')
+    {
+        --Length;
+        ++NumPadding;
+    }
+
+    uint64 Index{0};
+    uint64 OutIndex{0};
+
+    for(; Index + 32 <= Length; Index += 32, OutIndex += 24)
+    {
+        int32 Invalid;
+        const Simd::uint8_32 Bytes{DecodeBlock(Text + Index, Tables, Invalid)};
+
+        //the scalar loop below finds the exact position and decodes the groups in front of it
+        if EXPECT(Invalid != 0, false)
+        {
+            break;
+        }
+
+        Memory::Copy(Out + OutIndex, Bytes.ToPtr(), 24);
+    }
+
+    uint32 Group{0};
+    uint32 NumGroupCharacters{0};
+
+    for(; Index < Length; ++Index)
+    {
+        const uint8 Value{Tables.Values[static_cast<uint8>(Text[Index])]};
+
+        if(Value == InvalidValue)
+        {
+            return FDecodeResult{OutIndex, Index};
+        }
+
+        Group = Group << 6 | Value;
+
+        if(++NumGroupCharacters == 4)
+        {
+            Out[OutIndex] = static_cast<uint8>(Group >> 16);
+            Out[OutIndex + 1] = static_cast<uint8>(Group >> 8);
+            Out[OutIndex + 2] = static_cast<uint8>(Group);
+
+            OutIndex += 3;
+            Group = 0;
+            NumGroupCharacters = 0;
+        }
+    }
+
+    //a single character can't hold a whole byte, two hold one and three hold two
+    if(NumGroupCharacters == 1)
+    {
+        return FDecodeResult{OutIndex, Length - 1};
+    }
+    else if(NumGroupCharacters == 2)
+    {
+        Out[OutIndex++] = static_cast<uint8>(Group >> 4);
+    }
+    else if(NumGroupCharacters == 3)
+    {
+        Out[OutIndex++] = static_cast<uint8>(Group >> 10);
+        Out[OutIndex++] = static_cast<uint8>(Group >> 2);
+    }
+
+    if(NumPadding != 0 && NumGroupCharacters + NumPadding != 4)
+    {
+        return FDecodeResult{OutIndex, Length};
+    }
+
+    return FDecodeResult{OutIndex, FDecodeResult::NoError};
+}
+
+void StringUtility::HexEncode(const uint8* Data, const uint64 NumBytes, char8* Out, const bool bUppercase)
+{
+    constexpr char8 LowercaseDigits[17]{"0123456789abcdef"};
+    constexpr char8 UppercaseDigits[17]{"0123456789ABCDEF"};
+
+    const char8* Digits{bUppercase ? UppercaseDigits : LowercaseDigits};
+
+    Simd::Internal::uint8_16 DigitTable;
+    Memory::Copy(&DigitTable, Digits, 16);
+
+    uint64 Index{0};
+    for(; Index + 16 <= NumBytes; Index += 16)
+    {
+        const Simd::Internal::uint8_16 Bytes{Simd::Load<Simd::uint8_16>(Data + Index).Vector};
+        const Simd::Internal::uint8_16 High{Bytes >> 4};
+        const Simd::Internal::uint8_16 Low{Bytes & 0x0F};
+
+        const Simd::Internal::uint8_32 Nibbles{__builtin_shufflevector(High, Low,
+            0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23,
+            8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31)};
+
+        const Simd::uint8_32 Characters{Simd::Internal::LookupNibbles(DigitTable, Nibbles)};
+        Memory::Copy(Out + Index * 2, Characters.ToPtr(), 32);
+    }
+
+    for(; Index < NumBytes; ++Index)
+    {
+        Out[Index * 2] = Digits[Data[Index] >> 4];
+        Out[Index * 2 + 1] = Digits[Data[Index] & 0x0F];
+    }
+}
+
+StringUtility::FDecodeResult StringUtility::HexDecode(const char8* Text, const uint64 NumCharacters, uint8* Out)
+{
+    const uint64 Length{NumCharacters & ~1ull};
+
+    uint64 Index{0};
+    for(; Index + 32 <= Length; Index += 32)
+    {
+        const Simd::uint8_32 Characters{Simd::Load<Simd::uint8_32>(reinterpret_cast<const uint8*>(Text + Index))};
+
+        //'A' to 'F' and 'a' to 'f' are the only characters that land in 'a' to 'f' once bit 5 is set, digits already have it
+        const Simd::uint8_32 Digits{Characters - Simd::uint8_32{static_cast<uint8>('0')}};
+        const Simd::uint8_32 Letters{(Characters | Simd::uint8_32{static_cast<uint8>(0x20)}) - Simd::uint8_32{static_cast<uint8>('a')}};
+
+        const Simd::TVectorMask<Simd::uint8_32> IsDigit{Digits < Simd::uint8_32{static_cast<uint8>(10)}};
+        const Simd::TVectorMask<Simd::uint8_32> IsLetter{Letters < Simd::uint8_32{static_cast<uint8>(6)}};
+
+        if EXPECT(!(IsDigit | IsLetter).All(), false)
+        {
+            break;
+        }
+
+        const Simd::uint8_32 Values{Simd::Select(IsDigit, Digits, Letters + Simd::uint8_32{static_cast<uint8>(10)})};
+
+        //High * 16 + Low for every pair of characters
+        const Simd::int16_16 Bytes{Simd::MultiplyAddPairsSaturate(Values, Simd::Reinterpret<Simd::int8_32>(Simd::uint16_16{static_cast<uint16>(0x0110)}))};
+
+        const Simd::uint8_16 Packed{Simd::Convert<Simd::uint8_16>(Bytes)};
+        Memory::Copy(Out + Index / 2, Packed.ToPtr(), 16);
+    }
+
+    for(; Index < Length; Index += 2)
+    {
+        const uint8 High{HexValue(Text[Index])};
+        const uint8 Low{HexValue(Text[Index + 1])};
+
+        if(High == InvalidValue || Low == InvalidValue)
+        {
+            return FDecodeResult{Index / 2, High == InvalidValue ? Index : Index + 1};
+        }
+
+        Out[Index / 2] = static_cast<uint8>(High << 4 | Low);
+    }
+
+    if(Length != NumCharacters)
+    {
+        return FDecodeResult{Length / 2, Length};
+    }
+
+    return FDecodeResult{Length / 2, FDecodeResult::NoError};
+}
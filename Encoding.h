@@ -0,0 +1,60 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "Simd.h"
+
+namespace StringUtility
+{
+
+    enum class EBase64Alphabet : uint8
+    {
+        Standard, //RFC 4648 section 4 with '+' and '/', padded with '='
+        UrlSafe   //RFC 4648 section 5 with '-' and '_', not padded
+    };
+
+    //NumBytes is the number of bytes written, when the input is invalid ErrorPosition is the index of the first offending character
+    //and NumBytes only covers the part decoded before it
+    struct FDecodeResult final
+    {
+        uint64 NumBytes;
+        uint64 ErrorPosition;
+
+        inline static const constinit uint64 NoError{~0ull};
+
+        inline bool IsValid() const
+        {
+            return ErrorPosition == NoError;
+        }
+    };
+
+    uint64 Base64EncodedSize(const uint64 NumBytes, const EBase64Alphabet Alphabet);
+
+    //An upper bound for the bytes NumCharacters of base64 decode into, the exact size depends on the padding
+    uint64 Base64DecodedMaxSize(const uint64 NumCharacters);
+
+    //Writes Base64EncodedSize characters to Out and returns their number, no terminator is appended
+    uint64 Base64Encode(const uint8* Data, const uint64 NumBytes, char8* Out, const EBase64Alphabet Alphabet);
+
+    //Decodes into Out, which needs room for Base64DecodedMaxSize bytes. Both alphabets accept the text with or without padding
+    FDecodeResult Base64Decode(const char8* Text, const uint64 NumCharacters, uint8* Out, const EBase64Alphabet Alphabet);
+
+    //Writes two lowercase or uppercase digits per byte to Out
+    void HexEncode(const uint8* Data, const uint64 NumBytes, char8* Out, const bool bUppercase = false);
+
+    //Decodes NumCharacters / 2 bytes into Out, either case is accepted. An odd length reports the last character as the error
+    FDecodeResult HexDecode(const char8* Text, const uint64 NumCharacters, uint8* Out);
+
+}
@@ -0,0 +1,144 @@
+#include "HalfFloat.h"
+
+namespace
+{
+    template<typename THalf>
+    using THalfRegister = std::conditional_t<std::is_same_v<THalf, float16>, Simd::float16_16, Simd::bfloat16_16>;
+
+    template<typename TVector, typename DataType>
+    ATTRAVX void StoreChunk(const TVector& Chunk, const uint64 Num, const uint64 First, DataType* Data)
+    {
+        Memory::Copy(Data + First, Chunk.ToPtr(), (Num - First < TVector::NumElements ? Num - First : TVector::NumElements) * sizeof(DataType));
+    }
+
+    template<typename THalf>
+    ATTRAVX void Widen(const THalf* Source, const uint64 Num, float32* Out)
+    {
+        using FHalfRegister = THalfRegister<THalf>;
+
+        for(uint64 First{0}; First < Num; First += FHalfRegister::NumElements)
+        {
+            const FHalfRegister Chunk{Simd::LoadChunk<FHalfRegister>(Source, Num, First)};
+
+            StoreChunk(Simd::WidenLow<Simd::float32_8>(Chunk), Num, First, Out);
+
+            if(Num - First > Simd::float32_8::NumElements)
+            {
+                StoreChunk(Simd::WidenHigh<Simd::float32_8>(Chunk), Num, First + Simd::float32_8::NumElements, Out);
+            }
+        }
+    }
+
+    template<typename THalf>
+    ATTRAVX void Narrow(const float32* Source, const uint64 Num, THalf* Out)
+    {
+        using FHalfRegister = THalfRegister<THalf>;
+
+        for(uint64 First{0}; First < Num; First += FHalfRegister::NumElements)
+        {
+            const Simd::float32_8 Low{Simd::LoadChunk<Simd::float32_8>(Source, Num, First)};
+            const Simd::float32_8 High{Num - First > Simd::float32_8::NumElements ? Simd::LoadChunk<Simd::float32_8>(Source, Num, First + Simd::float32_8::NumElements) : Simd::float32_8{0.f}};
+
+            StoreChunk(Simd::Narrow<FHalfRegister>(Low, High), Num, First, Out);
+        }
+    }
+
+    //both sides widened to float32_8 halves of 16 lanes, a float32 side is loaded as is
+    template<typename TData>
+    ATTRAVX void LoadWide(const TData* Data, const uint64 Num, const uint64 First, Simd::float32_8& Low, Simd::float32_8& High)
+    {
+        if constexpr(std::is_same_v<TData, float32>)
+        {
+            Low = Simd::LoadChunk<Simd::float32_8>(Data, Num, First);
+            High = Num - First > Simd::float32_8::NumElements ? Simd::LoadChunk<Simd::float32_8>(Data, Num, First + Simd::float32_8::NumElements) : Simd::float32_8{0.f};
+        }
+        else
+        {
+            const THalfRegister<TData> Chunk{Simd::LoadChunk<THalfRegister<TData>>(Data, Num, First)};
+            Low = Simd::WidenLow<Simd::float32_8>(Chunk);
+            High = Simd::WidenHigh<Simd::float32_8>(Chunk);
+        }
+    }
+
+    template<typename TLHS, typename TRHS>
+    ATTRAVX float32 MixedDot(const TLHS* LHS, const TRHS* RHS, const uint64 Num)
+    {
+        constexpr uint64 ChunkSize{Simd::float32_8::NumElements * 2};
+
+        //two independent chains per 16 values, two chunks per iteration keep four fmas in flight
+        Simd::float32_8 Sum0{0.f};
+        Simd::float32_8 Sum1{0.f};
+        Simd::float32_8 Sum2{0.f};
+        Simd::float32_8 Sum3{0.f};
+
+        uint64 First{0};
+        for(; First + ChunkSize * 2 <= Num; First += ChunkSize * 2)
+        {
+            Simd::float32_8 LHS0, LHS1, LHS2, LHS3;
+            Simd::float32_8 RHS0, RHS1, RHS2, RHS3;
+            LoadWide(LHS, Num, First, LHS0, LHS1);
+            LoadWide(LHS, Num, First + ChunkSize, LHS2, LHS3);
+            LoadWide(RHS, Num, First, RHS0, RHS1);
+            LoadWide(RHS, Num, First + ChunkSize, RHS2, RHS3);
+
+            Sum0 = Simd::FusedMultiplyAdd(LHS0, RHS0, Sum0);
+            Sum1 = Simd::FusedMultiplyAdd(LHS1, RHS1, Sum1);
+            Sum2 = Simd::FusedMultiplyAdd(LHS2, RHS2, Sum2);
+            Sum3 = Simd::FusedMultiplyAdd(LHS3, RHS3, Sum3);
+        }
+
+        //the zero padding of the last chunk adds nothing
+        for(; First < Num; First += ChunkSize)
+        {
+            Simd::float32_8 LHS0, LHS1;
+            Simd::float32_8 RHS0, RHS1;
+            LoadWide(LHS, Num, First, LHS0, LHS1);
+            LoadWide(RHS, Num, First, RHS0, RHS1);
+
+            Sum0 = Simd::FusedMultiplyAdd(LHS0, RHS0, Sum0);
+            Sum1 = Simd::FusedMultiplyAdd(LHS1, RHS1, Sum1);
+        }
+
+        return Simd::ReduceAdd((Sum0 + Sum1) + (Sum2 + Sum3));
+    }
+}
+
+void HalfFloat::ConvertToFloat32(const float16* Source, const uint64 Num, float32* Out)
+{
+    Widen(Source, Num, Out);
+}
+
+void HalfFloat::ConvertToFloat32(const bfloat16* Source, const uint64 Num, float32* Out)
+{
+    Widen(Source, Num, Out);
+}
+
+void HalfFloat::ConvertToFloat16(const float32* Source, const uint64 Num, float16* Out)
+{
+    Narrow(Source, Num, Out);
+}
+
+void HalfFloat::ConvertToBFloat16(const float32* Source, const uint64 Num, bfloat16* Out)
+{
+    Narrow(Source, Num, Out);
+}
+
+float32 HalfFloat::Dot(const float16* LHS, const float16* RHS, const uint64 Num)
+{
+    return MixedDot(LHS, RHS, Num);
+}
+
+float32 HalfFloat::Dot(const bfloat16* LHS, const bfloat16* RHS, const uint64 Num)
+{
+    return MixedDot(LHS, RHS, Num);
+}
+
+float32 HalfFloat::Dot(const float16* LHS, const float32* RHS, const uint64 Num)
+{
+    return MixedDot(LHS, RHS, Num);
+}
+
+float32 HalfFloat::Dot(const bfloat16* LHS, const float32* RHS, const uint64 Num)
+{
+    return MixedDot(LHS, RHS, Num);
+}
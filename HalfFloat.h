@@ -0,0 +1,42 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Simd.h"
+
+//Bulk conversions between float32 and the half precision storage types, and dot products that read half precision and accumulate in float32.
+//float16 converts with F16C, bfloat16 is the upper half of a float32. Narrowing rounds to nearest even, float16 overflows to infinity
+namespace HalfFloat
+{
+
+    void ConvertToFloat32(const float16* Source, const uint64 Num, float32* Out);
+
+    void ConvertToFloat32(const bfloat16* Source, const uint64 Num, float32* Out);
+
+    void ConvertToFloat16(const float32* Source, const uint64 Num, float16* Out);
+
+    void ConvertToBFloat16(const float32* Source, const uint64 Num, bfloat16* Out);
+
+    //Four fma accumulators of 8 lanes summed at the end. The widened products are never rounded on their own and the additions run in a
+    //different order, so the result is not bit for bit the one of a sequential float32 multiply and add loop
+    float32 Dot(const float16* LHS, const float16* RHS, const uint64 Num);
+
+    float32 Dot(const bfloat16* LHS, const bfloat16* RHS, const uint64 Num);
+
+    //half precision weights against float32 activations
+    float32 Dot(const float16* LHS, const float32* RHS, const uint64 Num);
+
+    float32 Dot(const bfloat16* LHS, const float32* RHS, const uint64 Num);
+
+}
@@ -0,0 +1,321 @@
+#include "Hash.h"
+
+namespace
+{
+    constexpr uint64 Prime32{0x9E3779B1};
+    constexpr uint64 Prime64A{0x9E3779B185EBCA87};
+    constexpr uint64 Prime64B{0xC2B2AE3D27D4EB4F};
+    constexpr uint64 Prime64C{0x165667B19E3779F9};
+
+    //stripes read the secret at an offset that moves by one word per stripe, so it holds 7 words plus one of padding
+    alignas(32) constexpr uint64 Secret[8]
+    {
+        0xBE4BA423396CFEB8, 0x1CAD21F72C81017C, 0xDB979083E96DD4DE, 0x1F67B3B7A4A44072,
+        0x78E5C0CC4EE679CB, 0x2172FFCC7DD05A82, 0x8E2443F7744608B8, 0x0000000000000000
+    };
+
+    constexpr uint64 MaxShortSize{32};
+    constexpr uint64 StripeSize{sizeof(Simd::uint64_4)};
+    constexpr uint64 StripesPerScramble{16};
+
+    //reads Size <= 8 bytes as the low bytes of a word
+    INLINE uint64 ReadPartial(const uint8* Data, const uint64 Size)
+    {
+        uint64 Word{0};
+        Memory::Copy(&Word, Data, Size);
+        return Word;
+    }
+
+    //xor of the two halves of the 128 bit product
+    INLINE uint64 MultiplyFold(const uint64 LHS, const uint64 RHS)
+    {
+        const uint128 Product{static_cast<uint128>(LHS) * RHS};
+        return static_cast<uint64>(Product) ^ static_cast<uint64>(Product >> 64);
+    }
+
+    ATTRAVX Simd::uint64_4 MultiplyFold(const Simd::uint64_4& LHS, const Simd::uint64_4& RHS)
+    {
+        return (LHS * RHS) ^ Simd::MultiplyHigh(LHS, RHS);
+    }
+
+    INLINE uint64 Avalanche(uint64 Hash)
+    {
+        Hash ^= Hash >> 37;
+        Hash *= Prime64C;
+        return Hash ^ (Hash >> 32);
+    }
+
+    ATTRAVX Simd::uint64_4 Avalanche(Simd::uint64_4 Hash)
+    {
+        Hash ^= Simd::ShiftRightBits<37>(Hash);
+        Hash *= Simd::uint64_4{Prime64C};
+        return Hash ^ Simd::ShiftRightBits<32>(Hash);
+    }
+
+    //The four words a short key is folded from. Up to 16 bytes the first and last 8 (which overlap below 16 and are the same bytes
+    //up to 8), above that the first and last 16
+    struct FShortWords final
+    {
+        uint64 Words[4];
+
+        INLINE FShortWords(const uint8* Data, const uint64 Size)
+            : Words{}
+        {
+            if(Size > 16)
+            {
+                Memory::Copy(Words, Data, 16);
+                Memory::Copy(Words + 2, Data + Size - 16, 16);
+            }
+            else if(Size > 0)
+            {
+                const uint64 Partial{Size < 8 ? Size : 8};
+
+                Words[0] = ReadPartial(Data, Partial);
+                Words[1] = ReadPartial(Data + Size - Partial, Partial);
+            }
+        }
+    };
+
+    uint64 HashShort(const uint8* Data, const uint64 Size, const uint64 Seed)
+    {
+        const FShortWords Short{Data, Size};
+
+        uint64 Hash{Size * Prime64A + MultiplyFold(Short.Words[0] ^ (Secret[0] + Seed), Short.Words[1] ^ (Secret[1] - Seed))};
+
+        if(Size > 16)
+        {
+            Hash += MultiplyFold(Short.Words[2] ^ (Secret[2] + Seed), Short.Words[3] ^ (Secret[3] - Seed));
+        }
+
+        return Avalanche(Hash);
+    }
+
+    ATTRAVX void AccumulateStripe(Simd::uint64_4& Accumulator, const uint8* Stripe, const uint64 SecretOffset, const uint64 Seed)
+    {
+        const Simd::uint64_4 Data{Simd::Load<Simd::uint64_4>(reinterpret_cast<const uint64*>(Stripe))};
+        const Simd::uint64_4 Key{Simd::Load<Simd::uint64_4>(Secret + SecretOffset) + Simd::uint64_4{Seed}};
+        const Simd::uint64_4 DataKey{Data ^ Key};
+
+        //the low and high 32 bits of every keyed lane multiplied with pmuludq, plus the raw data of the neighbouring lane so no input bit is lost
+        const Simd::uint64_4 Product{Simd::Internal::MultiplyEvenLanes<false>(DataKey.Vector, Simd::ShiftRightBits<32>(DataKey).Vector)};
+
+        Accumulator += Simd::uint64_4{Simd::ShuffleVector<Simd::uint64_4, 1, 0, 3, 2>(Data)} + Product;
+    }
+
+    ATTRAVX void ScrambleAccumulator(Simd::uint64_4& Accumulator)
+    {
+        Accumulator ^= Simd::ShiftRightBits<47>(Accumulator);
+        Accumulator ^= Simd::Load<Simd::uint64_4>(Secret + 3);
+        Accumulator *= Simd::uint64_4{Prime32};
+    }
+
+    uint64 HashLong(const uint8* Data, const uint64 Size, const uint64 Seed)
+    {
+        Simd::uint64_4 Accumulator{Prime32, Prime64A, Prime64B, Prime64C};
+
+        //the last stripe is always the final 32 bytes, so whole stripes only run up to one before it
+        const uint64 NumStripes{(Size - 1) / StripeSize};
+
+        for(uint64 Stripe{0}; Stripe < NumStripes; ++Stripe)
+        {
+            AccumulateStripe(Accumulator, Data + Stripe * StripeSize, Stripe % 4, Seed);
+
+            if((Stripe + 1) % StripesPerScramble == 0)
+            {
+                ScrambleAccumulator(Accumulator);
+            }
+        }
+
+        AccumulateStripe(Accumulator, Data + Size - StripeSize, 4, Seed);
+
+        const Simd::uint64_4 Keyed{Accumulator ^ Simd::Load<Simd::uint64_4>(Secret)};
+
+        return Avalanche(Size * Prime64A + MultiplyFold(Keyed[0], Keyed[1]) + MultiplyFold(Keyed[2], Keyed[3]));
+    }
+
+    //Polynomial 0x1EDC6F41 bit reversed
+    constexpr uint32 CrcPolynomial{0x82F63B78};
+
+    constexpr uint64 CrcLongBlock{8192};
+    constexpr uint64 CrcShortBlock{256};
+
+    //Byte lookup tables of the linear operator that feeds a crc through Length zero bytes, Mark Adler's method. Merging two streams
+    //is then crc(A) shifted by the length of B xor crc(B)
+    struct FCrcShiftTable final
+    {
+        uint32 Entries[4][256];
+    };
+
+    consteval uint32 MultiplyCrcMatrix(const uint32 (&Matrix)[32], uint32 Vector)
+    {
+        uint32 Sum{0};
+        for(int32 Row{0}; Vector != 0; ++Row, Vector >>= 1)
+        {
+            Sum ^= (Vector & 1) ? Matrix[Row] : 0;
+        }
+        return Sum;
+    }
+
+    consteval void SquareCrcMatrix(uint32 (&Square)[32], const uint32 (&Matrix)[32])
+    {
+        for(int32 Row{0}; Row < 32; ++Row)
+        {
+            Square[Row] = MultiplyCrcMatrix(Matrix, Matrix[Row]);
+        }
+    }
+
+    consteval FCrcShiftTable MakeCrcShiftTable(const uint64 Length)
+    {
+        //the operator for one zero bit, squared twice gives four bits, the loop squares on from one byte up to Length bytes
+        uint32 Odd[32]{CrcPolynomial};
+        for(int32 Row{1}; Row < 32; ++Row)
+        {
+            Odd[Row] = 1u << (Row - 1);
+        }
+
+        uint32 Even[32]{};
+        SquareCrcMatrix(Even, Odd);
+        SquareCrcMatrix(Odd, Even);
+
+        uint32 Operator[32]{};
+        for(uint64 Remaining{Length}; ; )
+        {
+            SquareCrcMatrix(Even, Odd);
+            Remaining >>= 1;
+            if(Remaining == 0)
+            {
+                for(int32 Row{0}; Row < 32; ++Row) Operator[Row] = Even[Row];
+                break;
+            }
+
+            SquareCrcMatrix(Odd, Even);
+            Remaining >>= 1;
+            if(Remaining == 0)
+            {
+                for(int32 Row{0}; Row < 32; ++Row) Operator[Row] = Odd[Row];
+                break;
+            }
+        }
+
+        FCrcShiftTable Table{};
+        for(uint32 Byte{0}; Byte < 256; ++Byte)
+        {
+            Table.Entries[0][Byte] = MultiplyCrcMatrix(Operator, Byte);
+            Table.Entries[1][Byte] = MultiplyCrcMatrix(Operator, Byte << 8);
+            Table.Entries[2][Byte] = MultiplyCrcMatrix(Operator, Byte << 16);
+            Table.Entries[3][Byte] = MultiplyCrcMatrix(Operator, Byte << 24);
+        }
+
+        return Table;
+    }
+
+    constexpr FCrcShiftTable CrcLongShift{MakeCrcShiftTable(CrcLongBlock)};
+    constexpr FCrcShiftTable CrcShortShift{MakeCrcShiftTable(CrcShortBlock)};
+
+    INLINE uint32 ShiftCrc(const FCrcShiftTable& Table, const uint32 Crc)
+    {
+        return Table.Entries[0][Crc & 0xFF] ^ Table.Entries[1][(Crc >> 8) & 0xFF] ^ Table.Entries[2][(Crc >> 16) & 0xFF] ^ Table.Entries[3][Crc >> 24];
+    }
+
+    INLINE uint64 CrcWord(const uint64 Crc, const uint8* Data)
+    {
+        uint64 Word;
+        Memory::Copy(&Word, Data, sizeof(Word));
+        return __builtin_ia32_crc32di(Crc, Word);
+    }
+
+    //runs three streams over consecutive blocks of BlockSize bytes for as long as three whole blocks are left
+    INLINE uint64 CrcInterleaved(uint64 Crc, const uint8*& Data, uint64& Size, const uint64 BlockSize, const FCrcShiftTable& Shift)
+    {
+        while(Size >= BlockSize * 3)
+        {
+            uint64 CrcB{0};
+            uint64 CrcC{0};
+
+            for(uint64 Offset{0}; Offset < BlockSize; Offset += sizeof(uint64))
+            {
+                Crc = CrcWord(Crc, Data + Offset);
+                CrcB = CrcWord(CrcB, Data + BlockSize + Offset);
+                CrcC = CrcWord(CrcC, Data + BlockSize * 2 + Offset);
+            }
+
+            Crc = ShiftCrc(Shift, static_cast<uint32>(Crc)) ^ CrcB;
+            Crc = ShiftCrc(Shift, static_cast<uint32>(Crc)) ^ CrcC;
+
+            Data += BlockSize * 3;
+            Size -= BlockSize * 3;
+        }
+
+        return Crc;
+    }
+}
+
+uint64 Simd::Hash64(const void* Data, const uint64 Size, const uint64 Seed)
+{
+    const uint8* Bytes{static_cast<const uint8*>(Data)};
+
+    return Size <= MaxShortSize ? HashShort(Bytes, Size, Seed) : HashLong(Bytes, Size, Seed);
+}
+
+void Simd::Hash64(const void* const* Keys, const uint64* Sizes, const uint64 NumKeys, uint64* Out, const uint64 Seed)
+{
+    const uint64_4 SeedVector{Seed};
+
+    uint64 First{0};
+    for(; First + uint64_4::NumElements <= NumKeys; First += uint64_4::NumElements)
+    {
+        //the reads are per key anyway, the multiplies and the avalanche are what runs four wide
+        alignas(32) uint64 Words[4][uint64_4::NumElements];
+
+        for(uint64 Lane{0}; Lane < uint64_4::NumElements; ++Lane)
+        {
+            const uint64 Size{Sizes[First + Lane]};
+            const FShortWords Short{static_cast<const uint8*>(Keys[First + Lane]), Size <= MaxShortSize ? Size : 0};
+
+            for(uint64 Word{0}; Word < 4; ++Word)
+            {
+                Words[Word][Lane] = Short.Words[Word];
+            }
+        }
+
+        const uint64_4 Size{Load<uint64_4>(Sizes + First)};
+
+        const uint64_4 Low{MultiplyFold(Load<uint64_4>(Words[0]) ^ (uint64_4{Secret[0]} + SeedVector), Load<uint64_4>(Words[1]) ^ (uint64_4{Secret[1]} - SeedVector))};
+        const uint64_4 High{MultiplyFold(Load<uint64_4>(Words[2]) ^ (uint64_4{Secret[2]} + SeedVector), Load<uint64_4>(Words[3]) ^ (uint64_4{Secret[3]} - SeedVector))};
+
+        const uint64_4 Hash{Avalanche(Size * uint64_4{Prime64A} + Low + Select(Size > uint64_4{16ull}, High, uint64_4{}))};
+
+        for(uint64 Lane{0}; Lane < uint64_4::NumElements; ++Lane)
+        {
+            Out[First + Lane] = Sizes[First + Lane] <= MaxShortSize ? Hash[Lane] : HashLong(static_cast<const uint8*>(Keys[First + Lane]), Sizes[First + Lane], Seed);
+        }
+    }
+
+    for(; First < NumKeys; ++First)
+    {
+        Out[First] = Hash64(Keys[First], Sizes[First], Seed);
+    }
+}
+
+uint32 Simd::Crc32C(const void* Data, const uint64 Size, const uint32 Crc)
+{
+    const uint8* Bytes{static_cast<const uint8*>(Data)};
+    uint64 Remaining{Size};
+
+    uint64 Result{~Crc};
+
+    Result = CrcInterleaved(Result, Bytes, Remaining, CrcLongBlock, CrcLongShift);
+    Result = CrcInterleaved(Result, Bytes, Remaining, CrcShortBlock, CrcShortShift);
+
+    for(; Remaining >= sizeof(uint64); Bytes += sizeof(uint64), Remaining -= sizeof(uint64))
+    {
+        Result = CrcWord(Result, Bytes);
+    }
+
+    for(; Remaining > 0; ++Bytes, --Remaining)
+    {
+        Result = __builtin_ia32_crc32qi(static_cast<uint32>(Result), *Bytes);
+    }
+
+    return ~static_cast<uint32>(Result);
+}
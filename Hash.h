@@ -0,0 +1,33 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "Simd.h"
+
+namespace Simd
+{
+
+    //Non cryptographic 64 bit hash of Size bytes at Data. Keys up to 32 bytes are folded with two 64x64 multiplies, longer ones run an
+    //xxh3 style accumulator over 32 byte stripes in a uint64_4. The values are not compatible with xxh3
+    uint64 Hash64(const void* Data, const uint64 Size, const uint64 Seed = 0);
+
+    //Hash64 of NumKeys keys with the same values, short keys are mixed four at a time in uint64_4 lanes
+    void Hash64(const void* const* Keys, const uint64* Sizes, const uint64 NumKeys, uint64* Out, const uint64 Seed = 0);
+
+    //CRC-32C (Castagnoli) of Size bytes at Data continuing from Crc. Large buffers run three independent crc32 streams so the
+    //instruction latency overlaps, their results are merged with precomputed shift tables
+    uint32 Crc32C(const void* Data, const uint64 Size, const uint32 Crc = 0);
+
+}
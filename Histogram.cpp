@@ -0,0 +1,137 @@
+#include "Histogram.h"
+
+namespace
+{
+    //blocks are merged before the 32 bit sub table counters, or their sum, can overflow
+    constexpr uint64 MaxBlockSize{1ull << 31};
+
+    constexpr uint32 NumSubTables{4};
+
+    //sub tables are only worth it while they stay in L1, larger bucket counts go straight to the output
+    constexpr uint32 MaxSubTableBits{10};
+
+    template<typename TKeyVector>
+    void BucketHistogram(const typename TKeyVector::ElementType* Keys, const uint64 Count, const uint32 Shift, const uint32 NumBits, uint64* Out)
+    {
+        using KeyType = typename TKeyVector::ElementType;
+
+        const uint64 NumBuckets{1ull << NumBits};
+        const KeyType BucketMask{static_cast<KeyType>(NumBuckets - 1)};
+
+        Memory::Set(Out, 0, NumBuckets * sizeof(uint64));
+
+        if(NumBits > MaxSubTableBits)
+        {
+            uint64 Index{0};
+            for(; Index + TKeyVector::NumElements <= Count; Index += TKeyVector::NumElements)
+            {
+                const TKeyVector Buckets{(Simd::Load<TKeyVector>(Keys + Index).Vector >> Shift) & BucketMask};
+
+                for(uint64 Lane{0}; Lane < TKeyVector::NumElements; ++Lane)
+                {
+                    ++Out[Buckets[Lane]];
+                }
+            }
+
+            for(; Index < Count; ++Index)
+            {
+                ++Out[(Keys[Index] >> Shift) & BucketMask];
+            }
+
+            return;
+        }
+
+        alignas(32) uint32 SubTables[NumSubTables][1 << MaxSubTableBits];
+
+        uint64 Index{0};
+        while(Index < Count)
+        {
+            Memory::Set(SubTables, 0, sizeof(SubTables));
+
+            const uint64 BlockEnd{Count - Index < MaxBlockSize ? Count : Index + MaxBlockSize};
+
+            for(; Index + TKeyVector::NumElements <= BlockEnd; Index += TKeyVector::NumElements)
+            {
+                const TKeyVector Buckets{(Simd::Load<TKeyVector>(Keys + Index).Vector >> Shift) & BucketMask};
+
+                for(uint64 Lane{0}; Lane < TKeyVector::NumElements; ++Lane)
+                {
+                    ++SubTables[Lane % NumSubTables][Buckets[Lane]];
+                }
+            }
+
+            for(; Index < BlockEnd; ++Index)
+            {
+                ++SubTables[0][(Keys[Index] >> Shift) & BucketMask];
+            }
+
+            for(uint64 Bucket{0}; Bucket < NumBuckets; ++Bucket)
+            {
+                Out[Bucket] += uint64{SubTables[0][Bucket]} + SubTables[1][Bucket] + SubTables[2][Bucket] + SubTables[3][Bucket];
+            }
+        }
+    }
+}
+
+void Simd::Histogram(const uint8* Data, const uint64 Count, uint64 Out[256])
+{
+    //consecutive bytes are spread over interleaved sub tables so repeated values don't serialize on a store to load dependency
+    alignas(32) uint32 SubTables[NumSubTables][256];
+
+    Memory::Set(Out, 0, 256 * sizeof(uint64));
+
+    uint64 Index{0};
+    while(Index < Count)
+    {
+        Memory::Set(SubTables, 0, sizeof(SubTables));
+
+        const uint64 BlockEnd{Count - Index < MaxBlockSize ? Count : Index + MaxBlockSize};
+
+        for(; Index + uint64_4::NumElements * sizeof(uint64) <= BlockEnd; Index += uint64_4::NumElements * sizeof(uint64))
+        {
+            const uint64_4 Block{Load<uint64_4>(reinterpret_cast<const uint64*>(Data + Index))};
+
+            for(uint64 Lane{0}; Lane < uint64_4::NumElements; ++Lane)
+            {
+                const uint64 Word{Block[Lane]};
+
+                ++SubTables[0][static_cast<uint8>(Word)];
+                ++SubTables[1][static_cast<uint8>(Word >> 8)];
+                ++SubTables[2][static_cast<uint8>(Word >> 16)];
+                ++SubTables[3][static_cast<uint8>(Word >> 24)];
+                ++SubTables[0][static_cast<uint8>(Word >> 32)];
+                ++SubTables[1][static_cast<uint8>(Word >> 40)];
+                ++SubTables[2][static_cast<uint8>(Word >> 48)];
+                ++SubTables[3][static_cast<uint8>(Word >> 56)];
+            }
+        }
+
+        for(; Index < BlockEnd; ++Index)
+        {
+            ++SubTables[0][Data[Index]];
+        }
+
+        for(uint32 Value{0}; Value < 256; Value += uint32_8::NumElements)
+        {
+            uint32_8 Sum{Load<uint32_8>(&SubTables[0][Value])};
+            Sum += Load<uint32_8>(&SubTables[1][Value]);
+            Sum += Load<uint32_8>(&SubTables[2][Value]);
+            Sum += Load<uint32_8>(&SubTables[3][Value]);
+
+            for(uint64 Lane{0}; Lane < uint32_8::NumElements; ++Lane)
+            {
+                Out[Value + Lane] += Sum[Lane];
+            }
+        }
+    }
+}
+
+void Simd::Histogram(const uint16* Keys, const uint64 Count, const uint32 Shift, const uint32 NumBits, uint64* Out)
+{
+    BucketHistogram<uint16_16>(Keys, Count, Shift, NumBits, Out);
+}
+
+void Simd::Histogram(const uint32* Keys, const uint64 Count, const uint32 Shift, const uint32 NumBits, uint64* Out)
+{
+    BucketHistogram<uint32_8>(Keys, Count, Shift, NumBits, Out);
+}
@@ -0,0 +1,83 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Simd.h"
+
+namespace Simd
+{
+
+    //Counts how often every byte value occurs in Data and writes the result to Out
+    void Histogram(const uint8* Data, const uint64 Count, uint64 Out[256]);
+
+    //Counts keys into (1 << NumBits) buckets selected by (Key >> Shift) & ((1 << NumBits) - 1) and writes the result to Out, one pass of a radix partition
+    void Histogram(const uint16* Keys, const uint64 Count, const uint32 Shift, const uint32 NumBits, uint64* Out);
+    void Histogram(const uint32* Keys, const uint64 Count, const uint32 Shift, const uint32 NumBits, uint64* Out);
+
+    //Counts the byte values 0 to NumSymbols - 1 with vector compares, faster than Histogram when the alphabet is small. Other values are ignored
+    template<uint32 NumSymbols>
+    void HistogramSmall(const uint8* Data, const uint64 Count, uint64 (&Out)[NumSymbols]);
+
+}
+
+template<uint32 NumSymbols>
+void Simd::HistogramSmall(const uint8* Data, const uint64 Count, uint64 (&Out)[NumSymbols])
+{
+    static_assert(NumSymbols > 0 && NumSymbols <= 16);
+
+    //the byte counters overflow after 255 blocks so they are folded into 64 bit totals with psadbw before that
+    constexpr uint64 MaxBlocksPerFold{255};
+
+    const Internal::char8_32 Zero{};
+
+    uint64_4 Totals[NumSymbols];
+
+    uint64 Index{0};
+    while(Index + uint8_32::NumElements <= Count)
+    {
+        uint8_32 Counters[NumSymbols];
+
+        const uint64 NumBlocks{(Count - Index) / uint8_32::NumElements};
+        const uint64 BlocksToFold{NumBlocks < MaxBlocksPerFold ? NumBlocks : MaxBlocksPerFold};
+
+        for(uint64 BlockIndex{0}; BlockIndex < BlocksToFold; ++BlockIndex, Index += uint8_32::NumElements)
+        {
+            const uint8_32 Block{Load<uint8_32>(Data + Index)};
+
+            for(uint32 Symbol{0}; Symbol < NumSymbols; ++Symbol)
+            {
+                //a matching lane compares to -1, subtracting it counts one
+                Counters[Symbol].Vector -= reinterpret_cast<Internal::uint8_32>(Block.Vector == static_cast<uint8>(Symbol));
+            }
+        }
+
+        for(uint32 Symbol{0}; Symbol < NumSymbols; ++Symbol)
+        {
+            Totals[Symbol].Vector += reinterpret_cast<Internal::uint64_4>(__builtin_ia32_psadbw256(reinterpret_cast<Internal::char8_32>(Counters[Symbol].Vector), Zero));
+        }
+    }
+
+    for(uint32 Symbol{0}; Symbol < NumSymbols; ++Symbol)
+    {
+        Out[Symbol] = Totals[Symbol][0] + Totals[Symbol][1] + Totals[Symbol][2] + Totals[Symbol][3];
+    }
+
+    for(; Index < Count; ++Index)
+    {
+        if(Data[Index] < NumSymbols)
+        {
+            ++Out[Data[Index]];
+        }
+    }
+}
@@ -0,0 +1,109 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Simd.h"
+
+//Bulk conversion between arrays of structs and structures of arrays for structs of 2, 3 or 4 fields of the same 8, 16 or 32 bit type,
+//like xyz positions, RGBA pixels or key value pairs. Every iteration loads NumFields registers of structs, shuffles them with
+//Simd::Deinterleave or Simd::Interleave and stores NumFields registers, so the loop is bound by memory rather than the shuffles.
+//The last partial group goes through a zero padded buffer and nothing past the arrays is read or written
+namespace Layout
+{
+    namespace Internal
+    {
+        template<typename T>
+        using TRegister = Simd::Internal::TVectorRegister<Simd::Internal::Vector32<T>, T>;
+    }
+
+    //Splits Num structs stored one after the other in Source into one array of Num values per field
+    template<uint64 NumFields, typename T>
+    ATTRAVX void Deinterleave(const T* Source, const uint64 Num, T* const (&Fields)[NumFields])
+    {
+        using FRegister = Internal::TRegister<T>;
+        constexpr uint64 NumLanes{FRegister::NumElements};
+
+        uint64 First{0};
+        for(; First + NumLanes <= Num; First += NumLanes)
+        {
+            FRegister Structs[NumFields];
+            for(uint64 Index{0}; Index < NumFields; ++Index)
+            {
+                Structs[Index] = Simd::Load<FRegister>(Source + First * NumFields + Index * NumLanes);
+            }
+
+            FRegister Split[NumFields];
+            Simd::Deinterleave(Structs, Split);
+
+            for(uint64 Field{0}; Field < NumFields; ++Field)
+            {
+                Memory::Copy(Fields[Field] + First, Split[Field].ToPtr(), sizeof(FRegister));
+            }
+        }
+
+        if(First < Num)
+        {
+            FRegister Structs[NumFields];
+            Memory::Copy(Structs, Source + First * NumFields, (Num - First) * NumFields * sizeof(T));
+
+            FRegister Split[NumFields];
+            Simd::Deinterleave(Structs, Split);
+
+            for(uint64 Field{0}; Field < NumFields; ++Field)
+            {
+                Memory::Copy(Fields[Field] + First, Split[Field].ToPtr(), (Num - First) * sizeof(T));
+            }
+        }
+    }
+
+    //Writes Num structs one after the other to Out, taking field F of every struct from Fields[F]
+    template<uint64 NumFields, typename T>
+    ATTRAVX void Interleave(const T* const (&Fields)[NumFields], const uint64 Num, T* Out)
+    {
+        using FRegister = Internal::TRegister<T>;
+        constexpr uint64 NumLanes{FRegister::NumElements};
+
+        uint64 First{0};
+        for(; First + NumLanes <= Num; First += NumLanes)
+        {
+            FRegister Split[NumFields];
+            for(uint64 Field{0}; Field < NumFields; ++Field)
+            {
+                Split[Field] = Simd::Load<FRegister>(Fields[Field] + First);
+            }
+
+            FRegister Structs[NumFields];
+            Simd::Interleave(Split, Structs);
+
+            for(uint64 Index{0}; Index < NumFields; ++Index)
+            {
+                Memory::Copy(Out + First * NumFields + Index * NumLanes, Structs[Index].ToPtr(), sizeof(FRegister));
+            }
+        }
+
+        if(First < Num)
+        {
+            FRegister Split[NumFields];
+            for(uint64 Field{0}; Field < NumFields; ++Field)
+            {
+                Memory::Copy(Split[Field].ToPtr(), Fields[Field] + First, (Num - First) * sizeof(T));
+            }
+
+            FRegister Structs[NumFields];
+            Simd::Interleave(Split, Structs);
+
+            Memory::Copy(Out + First * NumFields, Structs, (Num - First) * NumFields * sizeof(T));
+        }
+    }
+}
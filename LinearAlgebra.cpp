@@ -0,0 +1,306 @@
+#include "LinearAlgebra.h"
+
+namespace
+{
+    //the micro kernel tile, 12 accumulators, 2 loads of RHS and a broadcast of LHS fit in the 16 AVX2 registers
+    constexpr uint64 TileRows{6};
+    constexpr uint64 TileColumns{16};
+
+    //a packed LHS block stays in L2 and a packed TileColumns wide panel of RHS in L1 while the block is multiplied against it
+    constexpr uint64 BlockRows{144};
+    constexpr uint64 BlockDepth{256};
+    constexpr uint64 BlockColumns{1024};
+
+    static_assert(BlockRows % TileRows == 0 && BlockColumns % TileColumns == 0);
+
+    template<typename TVector>
+    ATTRAVX typename TVector::ElementType DotChunks(const typename TVector::ElementType* LHS, const typename TVector::ElementType* RHS, const uint64 Num)
+    {
+        constexpr uint64 Width{TVector::NumElements};
+
+        //four chains hide the fma latency
+        TVector Sum0{};
+        TVector Sum1{};
+        TVector Sum2{};
+        TVector Sum3{};
+
+        uint64 First{0};
+        for(; First + 4 * Width <= Num; First += 4 * Width)
+        {
+            Sum0 = Simd::FusedMultiplyAdd(Simd::Load<TVector>(LHS + First), Simd::Load<TVector>(RHS + First), Sum0);
+            Sum1 = Simd::FusedMultiplyAdd(Simd::Load<TVector>(LHS + First + Width), Simd::Load<TVector>(RHS + First + Width), Sum1);
+            Sum2 = Simd::FusedMultiplyAdd(Simd::Load<TVector>(LHS + First + 2 * Width), Simd::Load<TVector>(RHS + First + 2 * Width), Sum2);
+            Sum3 = Simd::FusedMultiplyAdd(Simd::Load<TVector>(LHS + First + 3 * Width), Simd::Load<TVector>(RHS + First + 3 * Width), Sum3);
+        }
+
+        //the zero padding of the last chunk adds nothing
+        for(; First < Num; First += Width)
+        {
+            Sum0 = Simd::FusedMultiplyAdd(Simd::LoadChunk<TVector>(LHS, Num, First), Simd::LoadChunk<TVector>(RHS, Num, First), Sum0);
+        }
+
+        return Simd::ReduceAdd((Sum0 + Sum1) + (Sum2 + Sum3));
+    }
+
+    template<typename TVector>
+    ATTRAVX void AxpyChunks(const typename TVector::ElementType Alpha, const typename TVector::ElementType* X, const uint64 Num, typename TVector::ElementType* Y)
+    {
+        const TVector Scale{Alpha};
+
+        for(uint64 First{0}; First < Num; First += TVector::NumElements)
+        {
+            const TVector Result{Simd::FusedMultiplyAdd(Scale, Simd::LoadChunk<TVector>(X, Num, First), Simd::LoadChunk<TVector>(Y, Num, First))};
+
+            const uint64 NumLeft{Num - First};
+            Memory::Copy(Y + First, Result.ToPtr(), (NumLeft < TVector::NumElements ? NumLeft : TVector::NumElements) * sizeof(typename TVector::ElementType));
+        }
+    }
+
+    //Copies Depth rows of a Columns wide block of RHS into TileColumns wide panels, each panel is Depth runs of TileColumns floats.
+    //The last panel is zero padded so the micro kernel never needs a column mask
+    void PackRHS(const float32* Source, const uint64 RowStride, const uint64 Depth, const uint64 Columns, float32* Out)
+    {
+        for(uint64 Column{0}; Column < Columns; Column += TileColumns)
+        {
+            const uint64 Width{Columns - Column < TileColumns ? Columns - Column : TileColumns};
+
+            for(uint64 Row{0}; Row < Depth; ++Row)
+            {
+                Memory::Copy(Out, Source + Row * RowStride + Column, Width * sizeof(float32));
+
+                for(uint64 Pad{Width}; Pad < TileColumns; ++Pad)
+                {
+                    Out[Pad] = 0.f;
+                }
+
+                Out += TileColumns;
+            }
+        }
+    }
+
+    //Copies a Rows x Depth block of LHS into TileRows high panels, each panel is Depth columns of TileRows floats, zero padded past Rows
+    void PackLHS(const float32* Source, const uint64 RowStride, const uint64 Rows, const uint64 Depth, float32* Out)
+    {
+        for(uint64 Row{0}; Row < Rows; Row += TileRows)
+        {
+            const uint64 Height{Rows - Row < TileRows ? Rows - Row : TileRows};
+
+            for(uint64 Column{0}; Column < Depth; ++Column)
+            {
+                for(uint64 Lane{0}; Lane < TileRows; ++Lane)
+                {
+                    Out[Lane] = Lane < Height ? Source[(Row + Lane) * RowStride + Column] : 0.f;
+                }
+
+                Out += TileRows;
+            }
+        }
+    }
+
+    //Multiplies a packed LHS panel with a packed RHS panel and adds the tile to Out, or overwrites Out when bLoadOut is clear.
+    //Partial tiles at the bottom and right edge are computed in full and only their valid part is written
+    ATTRAVX void MultiplyTile(const float32* PackedLHS, const float32* PackedRHS, const uint64 Depth, float32* Out, const uint64 RowStride,
+        const uint64 Rows, const uint64 Columns, const bool bLoadOut)
+    {
+        //default constructed registers are zero
+        Simd::float32_8 Sum[TileRows][2];
+
+        for(uint64 Step{0}; Step < Depth; ++Step)
+        {
+            const Simd::float32_8 RHS0{Simd::Load<Simd::float32_8>(PackedRHS)};
+            const Simd::float32_8 RHS1{Simd::Load<Simd::float32_8>(PackedRHS + Simd::float32_8::NumElements)};
+
+            for(uint64 Row{0}; Row < TileRows; ++Row)
+            {
+                const Simd::float32_8 LHS{PackedLHS[Row]};
+                Sum[Row][0] = Simd::FusedMultiplyAdd(LHS, RHS0, Sum[Row][0]);
+                Sum[Row][1] = Simd::FusedMultiplyAdd(LHS, RHS1, Sum[Row][1]);
+            }
+
+            PackedLHS += TileRows;
+            PackedRHS += TileColumns;
+        }
+
+        if EXPECT(Rows == TileRows && Columns == TileColumns, true)
+        {
+            for(uint64 Row{0}; Row < TileRows; ++Row)
+            {
+                float32* OutRow{Out + Row * RowStride};
+
+                if(bLoadOut)
+                {
+                    Sum[Row][0] += Simd::Load<Simd::float32_8>(OutRow);
+                    Sum[Row][1] += Simd::Load<Simd::float32_8>(OutRow + Simd::float32_8::NumElements);
+                }
+
+                Memory::Copy(OutRow, Sum[Row][0].ToPtr(), sizeof(Simd::float32_8));
+                Memory::Copy(OutRow + Simd::float32_8::NumElements, Sum[Row][1].ToPtr(), sizeof(Simd::float32_8));
+            }
+
+            return;
+        }
+
+        for(uint64 Row{0}; Row < Rows; ++Row)
+        {
+            float32* OutRow{Out + Row * RowStride};
+
+            for(uint64 Column{0}; Column < Columns; ++Column)
+            {
+                const float32 Value{Sum[Row][Column / Simd::float32_8::NumElements][Column % Simd::float32_8::NumElements]};
+                OutRow[Column] = bLoadOut ? OutRow[Column] + Value : Value;
+            }
+        }
+    }
+
+    //the packing buffers of a thread, freed when it exits
+    struct FPackingBuffers final
+    {
+        ~FPackingBuffers()
+        {
+            if(LHS != nullptr)
+            {
+                Memory::FreeAligned<64>(LHS);
+                Memory::FreeAligned<64>(RHS);
+            }
+        }
+
+        float32* LHS{nullptr};
+        float32* RHS{nullptr};
+    };
+
+    thread_local FPackingBuffers PackingBuffers;
+}
+
+float32 LinearAlgebra::Dot(const float32* LHS, const float32* RHS, const uint64 Num)
+{
+    return DotChunks<Simd::float32_8>(LHS, RHS, Num);
+}
+
+float64 LinearAlgebra::Dot(const float64* LHS, const float64* RHS, const uint64 Num)
+{
+    return DotChunks<Simd::float64_4>(LHS, RHS, Num);
+}
+
+void LinearAlgebra::Axpy(const float32 Alpha, const float32* X, const uint64 Num, float32* Y)
+{
+    AxpyChunks<Simd::float32_8>(Alpha, X, Num, Y);
+}
+
+void LinearAlgebra::Axpy(const float64 Alpha, const float64* X, const uint64 Num, float64* Y)
+{
+    AxpyChunks<Simd::float64_4>(Alpha, X, Num, Y);
+}
+
+void LinearAlgebra::CosineSimilarity(const float32* Query, const FConstMatrixView& Vectors, float32* Out)
+{
+    const uint64 Dimension{Vectors.NumColumns};
+    const float32 QueryLength{__builtin_sqrtf(Dot(Query, Query, Dimension))};
+
+    const auto Cosine{[QueryLength](const float32 Product, const float32 SquaredLength)
+    {
+        const float32 Denominator{QueryLength * __builtin_sqrtf(SquaredLength)};
+        return Denominator > 0.f ? Product / Denominator : 0.f;
+    }};
+
+    uint64 Row{0};
+    for(; Row + 4 <= Vectors.NumRows; Row += 4)
+    {
+        const float32* Vector0{Vectors.Data + Row * Vectors.RowStride};
+        const float32* Vector1{Vector0 + Vectors.RowStride};
+        const float32* Vector2{Vector1 + Vectors.RowStride};
+        const float32* Vector3{Vector2 + Vectors.RowStride};
+
+        Simd::float32_8 Product0{}, Product1{}, Product2{}, Product3{};
+        Simd::float32_8 Length0{}, Length1{}, Length2{}, Length3{};
+
+        for(uint64 First{0}; First < Dimension; First += Simd::float32_8::NumElements)
+        {
+            const Simd::float32_8 QueryChunk{Simd::LoadChunk<Simd::float32_8>(Query, Dimension, First)};
+            const Simd::float32_8 Chunk0{Simd::LoadChunk<Simd::float32_8>(Vector0, Dimension, First)};
+            const Simd::float32_8 Chunk1{Simd::LoadChunk<Simd::float32_8>(Vector1, Dimension, First)};
+            const Simd::float32_8 Chunk2{Simd::LoadChunk<Simd::float32_8>(Vector2, Dimension, First)};
+            const Simd::float32_8 Chunk3{Simd::LoadChunk<Simd::float32_8>(Vector3, Dimension, First)};
+
+            Product0 = Simd::FusedMultiplyAdd(QueryChunk, Chunk0, Product0);
+            Product1 = Simd::FusedMultiplyAdd(QueryChunk, Chunk1, Product1);
+            Product2 = Simd::FusedMultiplyAdd(QueryChunk, Chunk2, Product2);
+            Product3 = Simd::FusedMultiplyAdd(QueryChunk, Chunk3, Product3);
+
+            Length0 = Simd::FusedMultiplyAdd(Chunk0, Chunk0, Length0);
+            Length1 = Simd::FusedMultiplyAdd(Chunk1, Chunk1, Length1);
+            Length2 = Simd::FusedMultiplyAdd(Chunk2, Chunk2, Length2);
+            Length3 = Simd::FusedMultiplyAdd(Chunk3, Chunk3, Length3);
+        }
+
+        Out[Row] = Cosine(Simd::ReduceAdd(Product0), Simd::ReduceAdd(Length0));
+        Out[Row + 1] = Cosine(Simd::ReduceAdd(Product1), Simd::ReduceAdd(Length1));
+        Out[Row + 2] = Cosine(Simd::ReduceAdd(Product2), Simd::ReduceAdd(Length2));
+        Out[Row + 3] = Cosine(Simd::ReduceAdd(Product3), Simd::ReduceAdd(Length3));
+    }
+
+    for(; Row < Vectors.NumRows; ++Row)
+    {
+        const float32* Vector{Vectors.Data + Row * Vectors.RowStride};
+        Out[Row] = Cosine(Dot(Query, Vector, Dimension), Dot(Vector, Vector, Dimension));
+    }
+}
+
+void LinearAlgebra::Multiply(const FConstMatrixView& LHS, const FConstMatrixView& RHS, const FMatrixView& Out, const bool bAccumulate)
+{
+    const uint64 NumRows{LHS.NumRows};
+    const uint64 NumColumns{RHS.NumColumns};
+    const uint64 NumDepth{LHS.NumColumns};
+
+    ASSERT(RHS.NumRows == NumDepth && Out.NumRows == NumRows && Out.NumColumns == NumColumns);
+
+    //an empty product adds nothing, but still overwrites Out with zeroes
+    if(NumDepth == 0)
+    {
+        for(uint64 Row{0}; Row < NumRows && !bAccumulate; ++Row)
+        {
+            Memory::Set(Out.Data + Row * Out.RowStride, 0, NumColumns * sizeof(float32));
+        }
+
+        return;
+    }
+
+    if(PackingBuffers.LHS == nullptr)
+    {
+        PackingBuffers.LHS = Memory::AllocateAligned<64, float32>(BlockRows * BlockDepth);
+        PackingBuffers.RHS = Memory::AllocateAligned<64, float32>(BlockDepth * BlockColumns);
+    }
+
+    float32* PackedLHS{PackingBuffers.LHS};
+    float32* PackedRHS{PackingBuffers.RHS};
+
+    for(uint64 ColumnBlock{0}; ColumnBlock < NumColumns; ColumnBlock += BlockColumns)
+    {
+        const uint64 Columns{NumColumns - ColumnBlock < BlockColumns ? NumColumns - ColumnBlock : BlockColumns};
+
+        for(uint64 DepthBlock{0}; DepthBlock < NumDepth; DepthBlock += BlockDepth)
+        {
+            const uint64 Depth{NumDepth - DepthBlock < BlockDepth ? NumDepth - DepthBlock : BlockDepth};
+
+            //the first depth block overwrites Out unless accumulating, the later ones add their part
+            const bool bLoadOut{bAccumulate || DepthBlock > 0};
+
+            PackRHS(RHS.Data + DepthBlock * RHS.RowStride + ColumnBlock, RHS.RowStride, Depth, Columns, PackedRHS);
+
+            for(uint64 RowBlock{0}; RowBlock < NumRows; RowBlock += BlockRows)
+            {
+                const uint64 Rows{NumRows - RowBlock < BlockRows ? NumRows - RowBlock : BlockRows};
+
+                PackLHS(LHS.Data + RowBlock * LHS.RowStride + DepthBlock, LHS.RowStride, Rows, Depth, PackedLHS);
+
+                for(uint64 Column{0}; Column < Columns; Column += TileColumns)
+                {
+                    for(uint64 Row{0}; Row < Rows; Row += TileRows)
+                    {
+                        MultiplyTile(PackedLHS + Row * Depth, PackedRHS + Column * Depth, Depth, Out.Data + (RowBlock + Row) * Out.RowStride + ColumnBlock + Column,
+                            Out.RowStride, Rows - Row < TileRows ? Rows - Row : TileRows, Columns - Column < TileColumns ? Columns - Column : TileColumns, bLoadOut);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Simd.h"
+
+//row major, element (Row, Column) is at Data[Row * RowStride + Column]
+struct FConstMatrixView final
+{
+    const float32* Data;
+    uint64 NumRows;
+    uint64 NumColumns;
+    uint64 RowStride;
+};
+
+struct FMatrixView final
+{
+    float32* Data;
+    uint64 NumRows;
+    uint64 NumColumns;
+    uint64 RowStride;
+};
+
+//Single core dense kernels for the sizes where calling into a BLAS costs more than the work, vectors of a few hundred elements and
+//matrices up to about 512x512. Nothing allocates except Multiply, which keeps its packing buffers per thread after the first call
+namespace LinearAlgebra
+{
+
+    //Four fma accumulators summed at the end. The products are never rounded on their own and the additions run in a different order,
+    //so the result is not bit for bit the one of a sequential multiply and add loop
+    float32 Dot(const float32* LHS, const float32* RHS, const uint64 Num);
+
+    float64 Dot(const float64* LHS, const float64* RHS, const uint64 Num);
+
+    //Y += Alpha * X
+    void Axpy(const float32 Alpha, const float32* X, const uint64 Num, float32* Y);
+
+    void Axpy(const float64 Alpha, const float64* X, const uint64 Num, float64* Y);
+
+    //Out[Row] is the cosine of the angle between Query and that row of Vectors, Query holds Vectors.NumColumns floats.
+    //Four rows are processed together so every chunk of Query is loaded once per four rows. A zero length vector gives 0
+    void CosineSimilarity(const float32* Query, const FConstMatrixView& Vectors, float32* Out);
+
+    //Out = LHS * RHS, or Out += LHS * RHS when bAccumulate is set. LHS.NumColumns must equal RHS.NumRows and Out must be
+    //LHS.NumRows x RHS.NumColumns, Out may not overlap either input.
+    //Blocks of RHS and LHS are packed into contiguous panels sized for the L2 and L1 caches, a 6x16 micro kernel then keeps
+    //its tile of Out in twelve float32_8 registers and does two fmas per broadcast element of LHS
+    void Multiply(const FConstMatrixView& LHS, const FConstMatrixView& RHS, const FMatrixView& Out, const bool bAccumulate = false);
+
+}
@@ -0,0 +1,85 @@
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FMappedFile::FMappedFile()
+    : Data(nullptr)
+    , Size(0)
+    , bOpen(false)
+{
+}
+
+FMappedFile::~FMappedFile()
+{
+    Close();
+}
+
+bool FMappedFile::Open(const char8* Path)
+{
+    Close();
+
+    const int32 Descriptor{open(Path, O_RDONLY | O_CLOEXEC)};
+    if(Descriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat Status;
+    if(fstat(Descriptor, &Status) != 0)
+    {
+        close(Descriptor);
+        return false;
+    }
+
+    const uint64 FileSize{static_cast<uint64>(Status.st_size)};
+
+    //mmap refuses a length of 0, an empty file is simply open with nothing to read
+    if(FileSize > 0)
+    {
+        void* Mapping{mmap(nullptr, FileSize, PROT_READ, MAP_PRIVATE, Descriptor, 0)};
+
+        if(Mapping == MAP_FAILED)
+        {
+            close(Descriptor);
+            return false;
+        }
+
+        madvise(Mapping, FileSize, MADV_SEQUENTIAL);
+
+        Data = static_cast<const char8*>(Mapping);
+    }
+
+    //the mapping holds its own reference to the file
+    close(Descriptor);
+
+    Size = FileSize;
+    bOpen = true;
+    return true;
+}
+
+void FMappedFile::Close()
+{
+    if(Data != nullptr)
+    {
+        munmap(const_cast<char8*>(Data), Size);
+    }
+
+    Data = nullptr;
+    Size = 0;
+    bOpen = false;
+}
+
+void FMappedFile::ReleaseBefore(const uint64 Offset)
+{
+    const uint64 PageSize{static_cast<uint64>(sysconf(_SC_PAGESIZE))};
+    const uint64 End{(Offset < Size ? Offset : Size) / PageSize * PageSize};
+
+    //the pages are clean and file backed, so dropping them only costs a reread if they are touched again
+    if(Data != nullptr && End > 0)
+    {
+        madvise(const_cast<char8*>(Data), End, MADV_DONTNEED);
+    }
+}
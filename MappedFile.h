@@ -0,0 +1,61 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "Definitions.h"
+
+//A whole file mapped read only, so scanners run over the page cache without copying it into a buffer first.
+//The mapping is advised as sequential: the kernel reads ahead aggressively and frees pages soon after they were touched,
+//which keeps passes over files larger than memory from evicting everything else
+class FMappedFile final
+{
+public:
+
+    FMappedFile();
+
+    ~FMappedFile();
+
+    FMappedFile(const FMappedFile&) = delete;
+    FMappedFile& operator=(const FMappedFile&) = delete;
+
+    //Maps the file at Path and returns false when it can't be opened or mapped. An empty file opens with a null Data
+    bool Open(const char8* Path);
+
+    void Close();
+
+    //Tells the kernel the pages before Offset won't be read again, for long passes that shouldn't keep the whole file resident
+    void ReleaseBefore(const uint64 Offset);
+
+    inline const char8* GetData() const
+    {
+        return Data;
+    }
+
+    inline uint64 GetSize() const
+    {
+        return Size;
+    }
+
+    inline bool IsOpen() const
+    {
+        return bOpen;
+    }
+
+private:
+
+    const char8* Data;
+    uint64 Size;
+    bool bOpen;
+
+};
@@ -13,6 +13,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #pragma once
 
+#include <new>
 #include "Definitions.h"
 
 namespace Memory
@@ -37,4 +38,17 @@ namespace Memory
         return static_cast<TTarget>(__builtin_assume_aligned(Destination, Alignment));
     }
 
+    //Allocates uninitialized storage for Num objects of type TTarget, must be released with FreeAligned using the same Alignment
+    template<uint64 Alignment, typename TTarget>
+    INLINE TTarget* AllocateAligned(const uint64 Num)
+    {
+        return AssumeAligned<Alignment>(static_cast<TTarget*>(::operator new(Num * sizeof(TTarget), std::align_val_t{Alignment})));
+    }
+
+    template<uint64 Alignment, typename TTarget>
+    INLINE void FreeAligned(TTarget* Target)
+    {
+        ::operator delete(Target, std::align_val_t{Alignment});
+    }
+
 }
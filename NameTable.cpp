@@ -0,0 +1,169 @@
+#include "NameTable.h"
+#include "Hash.h"
+
+#include <bit>
+#include <new>
+
+namespace
+{
+    constexpr uint64 HandleMask{0xFFFFFFFF};
+
+    //a slot holds the upper half of the hash above the handle, 0 while it's free. Handles start at 1 and the hash half of the
+    //empty string's slot for None is not 0, so no claimed slot is 0
+    INLINE uint64 MakeSlot(const uint64 Hash, const uint32 Handle)
+    {
+        return (Hash & ~HandleMask) | Handle;
+    }
+
+    INLINE bool IsSameString(const FStaticString& LHS, const FStaticString& RHS)
+    {
+        return (LHS.GetCharacters() == RHS.GetCharacters()).All();
+    }
+}
+
+FNameTable::FNameTable(const uint32 InMaxNames)
+    : ShardCapacity(std::bit_ceil(InMaxNames / NumShards * 2 > 16 ? InMaxNames / NumShards * 2 : 16u))
+    , NumPages(InMaxNames / PageSize + 1)
+    , NextIndex(1)
+    , MaxNames(InMaxNames + 1)
+{
+    Slots = new std::atomic<uint64>[static_cast<uint64>(NumShards) * ShardCapacity]{};
+    Pages = new std::atomic<FStaticString*>[NumPages]{};
+
+    FStaticString* FirstPage{Memory::AllocateAligned<32, FStaticString>(PageSize)};
+    new (FirstPage) FStaticString{};
+
+    Pages[0].store(FirstPage, std::memory_order_relaxed);
+
+    //None already names the empty string, claiming its slot up front makes Intern and Find return it like any other name
+    const uint64 EmptyHash{Simd::Hash64(FirstPage->RawString(), FStaticString::NumCharacters)};
+    Slots[(EmptyHash & (NumShards - 1)) * ShardCapacity + (static_cast<uint32>(EmptyHash >> 6) & (ShardCapacity - 1))].store(MakeSlot(EmptyHash, 0), std::memory_order_relaxed);
+}
+
+FNameTable::~FNameTable()
+{
+    for(uint32 Page{0}; Page < NumPages; ++Page)
+    {
+        FStaticString* Strings{Pages[Page].load(std::memory_order_relaxed)};
+
+        if(Strings != nullptr)
+        {
+            Memory::FreeAligned<32>(Strings);
+        }
+    }
+
+    delete[] Pages;
+    delete[] Slots;
+}
+
+uint32 FNameTable::Allocate(const FStaticString& Name)
+{
+    //checked before the increment so a full table that keeps being asked can't wrap the counter
+    if(NextIndex.load(std::memory_order_relaxed) >= MaxNames)
+    {
+        return 0;
+    }
+
+    const uint32 Index{NextIndex.fetch_add(1, std::memory_order_relaxed)};
+    if(Index >= MaxNames)
+    {
+        return 0;
+    }
+
+    std::atomic<FStaticString*>& Page{Pages[Index >> PageBits]};
+    FStaticString* Strings{Page.load(std::memory_order_acquire)};
+
+    //the first index of a page is not necessarily the first to arrive, whoever installs the page wins and the others free theirs
+    if(Strings == nullptr)
+    {
+        FStaticString* NewStrings{Memory::AllocateAligned<32, FStaticString>(PageSize)};
+
+        if(Page.compare_exchange_strong(Strings, NewStrings, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            Strings = NewStrings;
+        }
+        else
+        {
+            Memory::FreeAligned<32>(NewStrings);
+        }
+    }
+
+    //published by the release of the slot CAS that hands the handle out
+    new (&Strings[Index & (PageSize - 1)]) FStaticString{Name};
+
+    return Index;
+}
+
+FName FNameTable::Intern(const FStaticString& Name)
+{
+    const uint64 Hash{Simd::Hash64(Name.RawString(), FStaticString::NumCharacters)};
+
+    std::atomic<uint64>* Shard{Slots + (Hash & (NumShards - 1)) * ShardCapacity};
+    uint32 Position{static_cast<uint32>(Hash >> 6) & (ShardCapacity - 1)};
+
+    uint32 Reserved{0};
+
+    for(uint32 Probe{0}; Probe < ShardCapacity; ++Probe, Position = (Position + 1) & (ShardCapacity - 1))
+    {
+        uint64 Slot{Shard[Position].load(std::memory_order_acquire)};
+
+        if(Slot == 0)
+        {
+            //the string is written before the slot is claimed, so a reader that finds the handle always finds the string behind it
+            if(Reserved == 0)
+            {
+                Reserved = Allocate(Name);
+
+                if(Reserved == 0)
+                {
+                    return FName{};
+                }
+            }
+
+            if(Shard[Position].compare_exchange_strong(Slot, MakeSlot(Hash, Reserved), std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                return FName{Reserved};
+            }
+
+            //another thread claimed the slot first, Slot now holds its entry and may be the same string
+        }
+
+        if((Slot & ~HandleMask) == (Hash & ~HandleMask) && IsSameString(Resolve(FName{static_cast<uint32>(Slot)}), Name))
+        {
+            return FName{static_cast<uint32>(Slot)};
+        }
+    }
+
+    return FName{};
+}
+
+FName FNameTable::Find(const FStaticString& Name) const
+{
+    const uint64 Hash{Simd::Hash64(Name.RawString(), FStaticString::NumCharacters)};
+
+    const std::atomic<uint64>* Shard{Slots + (Hash & (NumShards - 1)) * ShardCapacity};
+    uint32 Position{static_cast<uint32>(Hash >> 6) & (ShardCapacity - 1)};
+
+    for(uint32 Probe{0}; Probe < ShardCapacity; ++Probe, Position = (Position + 1) & (ShardCapacity - 1))
+    {
+        const uint64 Slot{Shard[Position].load(std::memory_order_acquire)};
+
+        if(Slot == 0)
+        {
+            return FName{};
+        }
+
+        if((Slot & ~HandleMask) == (Hash & ~HandleMask) && IsSameString(Resolve(FName{static_cast<uint32>(Slot)}), Name))
+        {
+            return FName{static_cast<uint32>(Slot)};
+        }
+    }
+
+    return FName{};
+}
+
+uint32 FNameTable::Num() const
+{
+    const uint32 Next{NextIndex.load(std::memory_order_relaxed)};
+    return (Next < MaxNames ? Next : MaxNames) - 1;
+}
@@ -0,0 +1,112 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include "String.h"
+
+//32 bit handle to a string interned in an FNameTable, like an Unreal FName. Equal strings interned in the same table get equal
+//handles, so comparing two names is one integer compare. The default handle is None and resolves to the empty string
+class FName final
+{
+public:
+
+    constexpr FName()
+        : Handle(0)
+    {
+    }
+
+    explicit constexpr FName(const uint32 InHandle)
+        : Handle(InHandle)
+    {
+    }
+
+    inline constexpr bool operator==(const FName Other) const
+    {
+        return Handle == Other.Handle;
+    }
+
+    inline constexpr bool operator!=(const FName Other) const
+    {
+        return Handle != Other.Handle;
+    }
+
+    inline constexpr bool IsNone() const
+    {
+        return Handle == 0;
+    }
+
+    inline constexpr uint32 GetHandle() const
+    {
+        return Handle;
+    }
+
+private:
+
+    uint32 Handle;
+
+};
+
+//Interns FStaticStrings into 32 bit handles from any number of threads without locks. The strings live in append only pages of
+//32 byte aligned FStaticStrings, the handle is the index of a string in them, so resolving one is two loads and never waits.
+//The index is kept in open addressing shards whose slots hold the handle next to 32 bits of the hash and are claimed with a CAS.
+//The capacity is fixed when the table is built, strings are never removed
+class FNameTable final
+{
+public:
+
+    inline static constexpr uint32 NumShards{64};
+    inline static constexpr uint32 PageBits{12};
+    inline static constexpr uint32 PageSize{1u << PageBits};
+
+    //MaxNames bounds the number of distinct strings, every shard is sized for twice its share of them
+    explicit FNameTable(const uint32 InMaxNames = 1u << 20);
+
+    ~FNameTable();
+
+    FNameTable(const FNameTable&) = delete;
+    FNameTable& operator=(const FNameTable&) = delete;
+
+    //Returns the handle of Name and adds it when it's new, the empty string is None. Returns None once the table or the shard of Name is full.
+    //Two threads adding the same new string at once both get the same handle, the loser's arena entry stays unused
+    FName Intern(const FStaticString& Name);
+
+    //Returns the handle of Name or None when it was never interned
+    FName Find(const FStaticString& Name) const;
+
+    //The interned string, valid for as long as the table. Wait free: a page load and the string address
+    inline const FStaticString& Resolve(const FName Name) const
+    {
+        const uint32 Index{Name.GetHandle()};
+        return Pages[Index >> PageBits].load(std::memory_order_acquire)[Index & (PageSize - 1)];
+    }
+
+    //The number of arena entries handed out, including the ones left unused by racing inserts
+    uint32 Num() const;
+
+private:
+
+    uint32 Allocate(const FStaticString& Name);
+
+    std::atomic<uint64>* Slots;
+    uint32 ShardCapacity;
+
+    std::atomic<FStaticString*>* Pages;
+    uint32 NumPages;
+
+    //the next arena index, 0 is the empty string behind None
+    std::atomic<uint32> NextIndex;
+    uint32 MaxNames;
+
+};
@@ -0,0 +1,29 @@
+#include "PopCount.h"
+#include "Math.h"
+
+uint64 Simd::PopCount(const uint8* Data, const uint64 Count)
+{
+    const uint64 NumVectors{Count / sizeof(uint64_4)};
+
+    uint64 Result{PopCountVectors(NumVectors, [Data](const uint64 Index)
+    {
+        return Load<uint64_4>(reinterpret_cast<const uint64*>(Data + Index * sizeof(uint64_4)));
+    })};
+
+    uint64 Index{NumVectors * sizeof(uint64_4)};
+
+    for(; Index + sizeof(uint64) <= Count; Index += sizeof(uint64))
+    {
+        uint64 Word;
+        Memory::Copy(&Word, Data + Index, sizeof(Word));
+
+        Result += Math::NumActiveBits(Word);
+    }
+
+    for(; Index < Count; ++Index)
+    {
+        Result += Math::NumActiveBits(static_cast<uint32>(Data[Index]));
+    }
+
+    return Result;
+}
@@ -0,0 +1,101 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "Simd.h"
+
+namespace Simd
+{
+
+    //Number of set bits in the Count bytes at Data
+    uint64 PopCount(const uint8* Data, const uint64 Count);
+
+    //Number of set bits in the NumVectors registers of 64 bit lanes returned by LoadVector(Index). Blocks of 16 go through a Harley-Seal
+    //carry save adder tree so only one register in sixteen needs a full PopCount, the loader can fuse another operation like an And
+    template<typename TLoadVector>
+    uint64 PopCountVectors(const uint64 NumVectors, TLoadVector LoadVector);
+
+    namespace Internal
+    {
+        //adds three bit planes of the same weight, Low gets their sum bits and High the carries of twice the weight
+        template<typename TVector>
+        ATTRAVX void CarrySaveAdd(TVector& High, TVector& Low, const TVector A, const TVector B, const TVector C)
+        {
+            const TVector Partial{A ^ B};
+
+            High = (A & B) | (Partial & C);
+            Low = Partial ^ C;
+        }
+    }
+
+}
+
+template<typename TLoadVector>
+uint64 Simd::PopCountVectors(const uint64 NumVectors, TLoadVector LoadVector)
+{
+    using TVector = decltype(LoadVector(uint64{0}));
+
+    static_assert(std::is_same_v<typename TVector::ElementType, uint64>);
+
+    constexpr uint64 NumBlockVectors{16};
+
+    TVector Total{};
+    TVector Ones{};
+    TVector Twos{};
+    TVector Fours{};
+    TVector Eights{};
+
+    uint64 Index{0};
+    for(; Index + NumBlockVectors <= NumVectors; Index += NumBlockVectors)
+    {
+        TVector TwosA, TwosB, FoursA, FoursB, EightsA, EightsB, Sixteens;
+
+        Internal::CarrySaveAdd(TwosA, Ones, Ones, LoadVector(Index + 0), LoadVector(Index + 1));
+        Internal::CarrySaveAdd(TwosB, Ones, Ones, LoadVector(Index + 2), LoadVector(Index + 3));
+        Internal::CarrySaveAdd(FoursA, Twos, Twos, TwosA, TwosB);
+        Internal::CarrySaveAdd(TwosA, Ones, Ones, LoadVector(Index + 4), LoadVector(Index + 5));
+        Internal::CarrySaveAdd(TwosB, Ones, Ones, LoadVector(Index + 6), LoadVector(Index + 7));
+        Internal::CarrySaveAdd(FoursB, Twos, Twos, TwosA, TwosB);
+        Internal::CarrySaveAdd(EightsA, Fours, Fours, FoursA, FoursB);
+
+        Internal::CarrySaveAdd(TwosA, Ones, Ones, LoadVector(Index + 8), LoadVector(Index + 9));
+        Internal::CarrySaveAdd(TwosB, Ones, Ones, LoadVector(Index + 10), LoadVector(Index + 11));
+        Internal::CarrySaveAdd(FoursA, Twos, Twos, TwosA, TwosB);
+        Internal::CarrySaveAdd(TwosA, Ones, Ones, LoadVector(Index + 12), LoadVector(Index + 13));
+        Internal::CarrySaveAdd(TwosB, Ones, Ones, LoadVector(Index + 14), LoadVector(Index + 15));
+        Internal::CarrySaveAdd(FoursB, Twos, Twos, TwosA, TwosB);
+        Internal::CarrySaveAdd(EightsB, Fours, Fours, FoursA, FoursB);
+
+        Internal::CarrySaveAdd(Sixteens, Eights, Eights, EightsA, EightsB);
+
+        Total += PopCount(Sixteens);
+    }
+
+    //the planes left in the adders still hold bits of weight 8, 4, 2 and 1
+    Total = ShiftLeftBits<4>(Total) + ShiftLeftBits<3>(PopCount(Eights)) + ShiftLeftBits<2>(PopCount(Fours)) + ShiftLeftBits<1>(PopCount(Twos)) + PopCount(Ones);
+
+    for(; Index < NumVectors; ++Index)
+    {
+        Total += PopCount(LoadVector(Index));
+    }
+
+    uint64 Result{0};
+    for(uint64 Lane{0}; Lane < TVector::NumElements; ++Lane)
+    {
+        Result += Total[Lane];
+    }
+
+    return Result;
+}
@@ -0,0 +1,300 @@
+#include "Profiling.h"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace
+{
+    std::atomic<int32> NumKernels{0};
+    std::atomic<const char8*> KernelNames[Profiling::MaxKernels];
+
+    //every thread that ever recorded, states are never freed so Snapshot can walk the list without synchronising with thread exit
+    std::atomic<Profiling::Internal::FThreadState*> FirstThreadState{nullptr};
+
+    struct FCounterEvent final
+    {
+        uint32 Type;
+        uint64 Config;
+    };
+
+    constexpr FCounterEvent CounterEvents[Profiling::NumCounters]
+    {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}
+    };
+
+    int32 OpenCounter(const FCounterEvent& Event, const int32 Group)
+    {
+        perf_event_attr Attributes{};
+        Attributes.size = sizeof(Attributes);
+        Attributes.type = Event.Type;
+        Attributes.config = Event.Config;
+        Attributes.read_format = PERF_FORMAT_GROUP;
+        Attributes.disabled = Group < 0 ? 1 : 0;
+        Attributes.exclude_kernel = 1;
+        Attributes.exclude_hv = 1;
+
+        //the calling thread on whichever cpu it runs
+        return static_cast<int32>(syscall(SYS_perf_event_open, &Attributes, 0, -1, Group, 0));
+    }
+
+    //closes the counters of a thread when it exits, the state itself stays for Snapshot
+    struct FCounterCloser final
+    {
+        ~FCounterCloser()
+        {
+            Profiling::DisableCounters();
+        }
+    };
+
+    thread_local FCounterCloser CounterCloser;
+}
+
+Profiling::FKernel::FKernel(const char8* KernelName)
+    : Name(KernelName)
+    , Index(NumKernels.fetch_add(1, std::memory_order_relaxed))
+{
+    if(Index < MaxKernels)
+    {
+        KernelNames[Index].store(Name, std::memory_order_release);
+    }
+}
+
+uint64 Profiling::FKernelStats::PercentileTicks(const float64 Fraction) const
+{
+    const uint64 Target{static_cast<uint64>(Fraction * static_cast<float64>(NumCalls))};
+
+    uint64 Seen{0};
+    for(int32 Bucket{0}; Bucket < NumBuckets; ++Bucket)
+    {
+        Seen += Buckets[Bucket];
+
+        if(Seen > Target)
+        {
+            return Bucket == 0 ? 0 : (1ull << Bucket) - 1;
+        }
+    }
+
+    return MaxTicks;
+}
+
+Profiling::Internal::FThreadState& Profiling::Internal::CreateThreadState()
+{
+    FThreadState* State{new FThreadState{}};
+
+    for(FKernelHistogram& Histogram : State->Kernels)
+    {
+        Histogram.MinTicks.store(~0ull, std::memory_order_relaxed);
+    }
+
+    State->CounterGroup = -1;
+    for(int32 Counter{0}; Counter < NumCounters; ++Counter)
+    {
+        State->CounterDescriptors[Counter] = -1;
+        State->CounterSlots[Counter] = -1;
+    }
+
+    State->Next = FirstThreadState.load(std::memory_order_relaxed);
+    while(!FirstThreadState.compare_exchange_weak(State->Next, State, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+
+    ThreadState = State;
+    return *State;
+}
+
+void Profiling::Internal::ReadCounters(const FThreadState& State, uint64 (&Values)[NumCounters])
+{
+    //PERF_FORMAT_GROUP reads the number of counters followed by their values in the order they were opened
+    uint64 Buffer[NumCounters + 1]{};
+    const bool bRead{read(State.CounterGroup, Buffer, sizeof(Buffer)) > 0};
+
+    for(int32 Counter{0}; Counter < NumCounters; ++Counter)
+    {
+        const int32 Slot{State.CounterSlots[Counter]};
+        Values[Counter] = bRead && Slot >= 0 ? Buffer[Slot + 1] : 0;
+    }
+}
+
+void Profiling::Internal::RecordCounters(FThreadState& State, const int32 KernelIndex, const uint64 Ticks, const uint64 (&StartCounters)[NumCounters])
+{
+    uint64 EndCounters[NumCounters];
+    ReadCounters(State, EndCounters);
+
+    if(KernelIndex >= MaxKernels)
+    {
+        return;
+    }
+
+    FKernelHistogram& Histogram{State.Kernels[KernelIndex]};
+
+    Add(Histogram.NumCountedCalls, 1);
+    Add(Histogram.CountedTicks, Ticks);
+
+    for(int32 Counter{0}; Counter < NumCounters; ++Counter)
+    {
+        Add(Histogram.Counters[Counter], EndCounters[Counter] - StartCounters[Counter]);
+    }
+}
+
+bool Profiling::EnableCounters()
+{
+    Internal::FThreadState& State{Internal::GetThreadState()};
+
+    if(State.CounterGroup >= 0)
+    {
+        return true;
+    }
+
+    //the cycle counter leads the group, without it there is nothing to compare the others against
+    const int32 Group{OpenCounter(CounterEvents[0], -1)};
+    if(Group < 0)
+    {
+        return false;
+    }
+
+    State.CounterDescriptors[0] = Group;
+    State.CounterSlots[0] = 0;
+
+    int32 NumOpen{1};
+    for(int32 Counter{1}; Counter < NumCounters; ++Counter)
+    {
+        const int32 Descriptor{OpenCounter(CounterEvents[Counter], Group)};
+
+        if(Descriptor >= 0)
+        {
+            State.CounterDescriptors[Counter] = Descriptor;
+            State.CounterSlots[Counter] = NumOpen++;
+        }
+    }
+
+    ioctl(Group, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(Group, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+    //touching the thread local registers its destructor for this thread
+    static_cast<void>(&CounterCloser);
+
+    State.CounterGroup = Group;
+    return true;
+}
+
+void Profiling::DisableCounters()
+{
+    if(Internal::ThreadState == nullptr || Internal::ThreadState->CounterGroup < 0)
+    {
+        return;
+    }
+
+    Internal::FThreadState& State{*Internal::ThreadState};
+
+    State.CounterGroup = -1;
+
+    for(int32 Counter{0}; Counter < NumCounters; ++Counter)
+    {
+        if(State.CounterDescriptors[Counter] >= 0)
+        {
+            close(State.CounterDescriptors[Counter]);
+        }
+
+        State.CounterDescriptors[Counter] = -1;
+        State.CounterSlots[Counter] = -1;
+    }
+}
+
+uint64 Profiling::Snapshot(FKernelStats* Out, const uint64 MaxStats)
+{
+    const int32 NumRegistered{NumKernels.load(std::memory_order_relaxed)};
+
+    uint64 NumStats{0};
+
+    for(int32 Kernel{0}; Kernel < NumRegistered && Kernel < MaxKernels && NumStats < MaxStats; ++Kernel)
+    {
+        const char8* Name{KernelNames[Kernel].load(std::memory_order_acquire)};
+        if(Name == nullptr)
+        {
+            continue;
+        }
+
+        FKernelStats& Stats{Out[NumStats]};
+        Stats = FKernelStats{};
+        Stats.Name = Name;
+        Stats.MinTicks = ~0ull;
+
+        for(const Internal::FThreadState* State{FirstThreadState.load(std::memory_order_acquire)}; State != nullptr; State = State->Next)
+        {
+            const Internal::FKernelHistogram& Histogram{State->Kernels[Kernel]};
+
+            Stats.NumCalls += Histogram.NumCalls.load(std::memory_order_relaxed);
+            Stats.TotalTicks += Histogram.TotalTicks.load(std::memory_order_relaxed);
+
+            const uint64 MinTicks{Histogram.MinTicks.load(std::memory_order_relaxed)};
+            const uint64 MaxTicks{Histogram.MaxTicks.load(std::memory_order_relaxed)};
+            Stats.MinTicks = MinTicks < Stats.MinTicks ? MinTicks : Stats.MinTicks;
+            Stats.MaxTicks = MaxTicks > Stats.MaxTicks ? MaxTicks : Stats.MaxTicks;
+
+            for(int32 Bucket{0}; Bucket < NumBuckets; ++Bucket)
+            {
+                Stats.Buckets[Bucket] += Histogram.Buckets[Bucket].load(std::memory_order_relaxed);
+            }
+
+            Stats.NumCountedCalls += Histogram.NumCountedCalls.load(std::memory_order_relaxed);
+            Stats.CountedTicks += Histogram.CountedTicks.load(std::memory_order_relaxed);
+
+            for(int32 Counter{0}; Counter < NumCounters; ++Counter)
+            {
+                Stats.Counters[Counter] += Histogram.Counters[Counter].load(std::memory_order_relaxed);
+            }
+        }
+
+        if(Stats.NumCalls == 0)
+        {
+            continue;
+        }
+
+        ++NumStats;
+    }
+
+    return NumStats;
+}
+
+void Profiling::Dump(std::FILE* Output)
+{
+    FKernelStats* Stats{new FKernelStats[MaxKernels]};
+    const uint64 NumStats{Snapshot(Stats, MaxKernels)};
+
+    std::fprintf(Output, "%-32s %12s %10s %10s %10s %10s %10s | %11s %6s %9s %9s %9s\n",
+        "kernel", "calls", "mean", "min", "p50", "p99", "max", "cycles/tick", "ipc", "l1 miss", "llc miss", "br miss");
+
+    for(uint64 Index{0}; Index < NumStats; ++Index)
+    {
+        const FKernelStats& Kernel{Stats[Index]};
+
+        std::fprintf(Output, "%-32s %12llu %10.1f %10llu %10llu %10llu %10llu", Kernel.Name, Kernel.NumCalls,
+            static_cast<float64>(Kernel.TotalTicks) / static_cast<float64>(Kernel.NumCalls), Kernel.MinTicks,
+            Kernel.PercentileTicks(0.5), Kernel.PercentileTicks(0.99), Kernel.MaxTicks);
+
+        if(Kernel.NumCountedCalls > 0 && Kernel.CountedTicks > 0 && Kernel.Counters[static_cast<int32>(ECounter::Cycles)] > 0)
+        {
+            const float64 NumCounted{static_cast<float64>(Kernel.NumCountedCalls)};
+            const float64 Cycles{static_cast<float64>(Kernel.Counters[static_cast<int32>(ECounter::Cycles)])};
+
+            //below 1 the core ran slower than the timestamp counter, throttled or waiting to leave a lower power state
+            std::fprintf(Output, " | %11.3f %6.2f %9.1f %9.1f %9.1f\n", Cycles / static_cast<float64>(Kernel.CountedTicks),
+                static_cast<float64>(Kernel.Counters[static_cast<int32>(ECounter::Instructions)]) / Cycles,
+                static_cast<float64>(Kernel.Counters[static_cast<int32>(ECounter::L1Misses)]) / NumCounted,
+                static_cast<float64>(Kernel.Counters[static_cast<int32>(ECounter::LLCMisses)]) / NumCounted,
+                static_cast<float64>(Kernel.Counters[static_cast<int32>(ECounter::BranchMisses)]) / NumCounted);
+        }
+        else
+        {
+            std::fprintf(Output, " |\n");
+        }
+    }
+
+    delete[] Stats;
+}
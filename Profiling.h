@@ -0,0 +1,239 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdio>
+#include "Definitions.h"
+
+//Scoped timers for hot kernels. PROFILE_SCOPE("Name") at the top of a block times it with rdtscp and adds the time to a histogram
+//owned by the calling thread, so recording never takes a lock or shares a cache line. Threads that called EnableCounters also add
+//the perf_event_open counters of the block, whose cycles against the timestamp ticks show when the core ran below its nominal
+//frequency, for example because of AVX-512 licences. Without SIMD_PROFILING the macro expands to nothing
+namespace Profiling
+{
+
+    enum class ECounter : uint8
+    {
+        Cycles,
+        Instructions,
+        L1Misses,     //L1 data cache read misses
+        LLCMisses,    //last level cache misses
+        BranchMisses,
+        Num
+    };
+
+    inline constexpr int32 NumCounters{static_cast<int32>(ECounter::Num)};
+    inline constexpr int32 NumBuckets{64};
+    inline constexpr int32 MaxKernels{128};
+
+    //One per instrumented site, PROFILE_SCOPE makes it a function local static. Kernels registered after the first MaxKernels are not recorded
+    class FKernel final
+    {
+    public:
+
+        explicit FKernel(const char8* KernelName);
+
+        inline const char8* GetName() const
+        {
+            return Name;
+        }
+
+        inline int32 GetIndex() const
+        {
+            return Index;
+        }
+
+    private:
+
+        const char8* Name;
+        int32 Index;
+
+    };
+
+    //The totals of one kernel over every thread
+    struct FKernelStats final
+    {
+        const char8* Name;
+
+        uint64 NumCalls;
+        uint64 TotalTicks;
+        uint64 MinTicks;
+        uint64 MaxTicks;
+
+        //Buckets[B] counts the calls that took [2^(B - 1), 2^B) ticks, bucket 0 the ones that took none
+        uint64 Buckets[NumBuckets];
+
+        //the calls made while counters were enabled, their ticks and the counter totals over them
+        uint64 NumCountedCalls;
+        uint64 CountedTicks;
+        uint64 Counters[NumCounters];
+
+        //An upper bound for the ticks of the call at Fraction of the sorted calls, exact to a power of two
+        uint64 PercentileTicks(const float64 Fraction) const;
+    };
+
+    namespace Internal
+    {
+
+        //written only by the owning thread, the atomics let Snapshot read them from another one without a data race
+        struct FKernelHistogram final
+        {
+            std::atomic<uint64> NumCalls;
+            std::atomic<uint64> TotalTicks;
+            std::atomic<uint64> MinTicks;
+            std::atomic<uint64> MaxTicks;
+            std::atomic<uint64> Buckets[NumBuckets];
+            std::atomic<uint64> NumCountedCalls;
+            std::atomic<uint64> CountedTicks;
+            std::atomic<uint64> Counters[NumCounters];
+        };
+
+        struct FThreadState final
+        {
+            FKernelHistogram Kernels[MaxKernels];
+
+            //the group leader descriptor, -1 while the thread has no counters
+            int32 CounterGroup;
+            int32 CounterDescriptors[NumCounters];
+
+            //position of every counter in the values read from the group, -1 when the kernel refused to open it
+            int32 CounterSlots[NumCounters];
+
+            FThreadState* Next;
+        };
+
+        inline thread_local FThreadState* ThreadState{nullptr};
+
+        FThreadState& CreateThreadState();
+
+        void ReadCounters(const FThreadState& State, uint64 (&Values)[NumCounters]);
+
+        INLINE FThreadState& GetThreadState()
+        {
+            return EXPECT(ThreadState != nullptr, true) ? *ThreadState : CreateThreadState();
+        }
+
+        //only the owning thread writes, so a plain load and store is enough and avoids a locked instruction
+        INLINE void Add(std::atomic<uint64>& Target, const uint64 Value)
+        {
+            Target.store(Target.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+        }
+
+        INLINE void Record(FThreadState& State, const int32 KernelIndex, const uint64 Ticks)
+        {
+            if EXPECT(KernelIndex >= MaxKernels, false)
+            {
+                return;
+            }
+
+            FKernelHistogram& Histogram{State.Kernels[KernelIndex]};
+
+            const int32 Bucket{Ticks == 0 ? 0 : 64 - __builtin_clzll(Ticks)};
+
+            Add(Histogram.NumCalls, 1);
+            Add(Histogram.TotalTicks, Ticks);
+            Add(Histogram.Buckets[Bucket < NumBuckets ? Bucket : NumBuckets - 1], 1);
+
+            if(Ticks < Histogram.MinTicks.load(std::memory_order_relaxed))
+            {
+                Histogram.MinTicks.store(Ticks, std::memory_order_relaxed);
+            }
+            if(Ticks > Histogram.MaxTicks.load(std::memory_order_relaxed))
+            {
+                Histogram.MaxTicks.store(Ticks, std::memory_order_relaxed);
+            }
+        }
+
+        void RecordCounters(FThreadState& State, const int32 KernelIndex, const uint64 Ticks, const uint64 (&StartCounters)[NumCounters]);
+
+    }
+
+    //rdtscp waits for every earlier instruction to execute and the lfence keeps later ones from starting before the read.
+    //The timestamp counter runs at a constant rate independent of the core frequency
+    INLINE uint64 ReadTimestamp()
+    {
+        uint32 Processor;
+        const uint64 Timestamp{__builtin_ia32_rdtscp(&Processor)};
+        __builtin_ia32_lfence();
+        return Timestamp;
+    }
+
+    //Opens the hardware counters for the calling thread and returns whether at least the cycle counter is available. Fails when
+    //perf_event_paranoid or a container forbids it, timing keeps working either way. Every counted scope costs two read syscalls
+    bool EnableCounters();
+
+    void DisableCounters();
+
+    class FScope final
+    {
+    public:
+
+        INLINE explicit FScope(const FKernel& TimedKernel)
+            : Kernel(TimedKernel)
+            , State(Internal::GetThreadState())
+        {
+            //counters first and timestamp last so the timed region doesn't include the syscall
+            if EXPECT(State.CounterGroup >= 0, false)
+            {
+                Internal::ReadCounters(State, StartCounters);
+            }
+
+            StartTicks = ReadTimestamp();
+        }
+
+        INLINE ~FScope()
+        {
+            const uint64 Ticks{ReadTimestamp() - StartTicks};
+
+            if EXPECT(State.CounterGroup >= 0, false)
+            {
+                Internal::RecordCounters(State, Kernel.GetIndex(), Ticks, StartCounters);
+            }
+
+            Internal::Record(State, Kernel.GetIndex(), Ticks);
+        }
+
+        FScope(const FScope&) = delete;
+        FScope& operator=(const FScope&) = delete;
+
+    private:
+
+        const FKernel& Kernel;
+        Internal::FThreadState& State;
+
+        uint64 StartTicks;
+        uint64 StartCounters[NumCounters];
+
+    };
+
+    //Sums the histograms of every thread that recorded anything, including threads that have exited. Threads still recording
+    //may be caught between two fields, so a kernel's totals can be one call apart. Writes up to MaxStats kernels and returns how many
+    uint64 Snapshot(FKernelStats* Out, const uint64 MaxStats);
+
+    //Snapshot printed as a table, one kernel per line
+    void Dump(std::FILE* Output);
+
+}
+
+#define PROFILE_CONCAT_INNER(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_INNER(A, B)
+
+#ifdef SIMD_PROFILING
+#define PROFILE_SCOPE(Name) \
+    static const Profiling::FKernel PROFILE_CONCAT(ProfileKernel, __LINE__){Name}; \
+    const Profiling::FScope PROFILE_CONCAT(ProfileScope, __LINE__){PROFILE_CONCAT(ProfileKernel, __LINE__)}
+#else
+#define PROFILE_SCOPE(Name) static_cast<void>(0)
+#endif
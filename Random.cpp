@@ -0,0 +1,116 @@
+#include "Random.h"
+
+namespace
+{
+    //the characteristic polynomials of advancing xoshiro256 by 2^128 and 2^192 steps
+    constexpr uint64 JumpPolynomial[4]{0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C};
+    constexpr uint64 LongJumpPolynomial[4]{0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635};
+
+    uint64 SplitMix64(uint64& Seed)
+    {
+        uint64 Value{Seed += 0x9E3779B97F4A7C15};
+        Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9;
+        Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EB;
+        return Value ^ (Value >> 31);
+    }
+}
+
+Simd::FRandom::FRandom(const uint64 Seed)
+{
+    uint64 SeedState{Seed};
+
+    uint64 LaneState[4];
+    for(uint64& Word : LaneState)
+    {
+        Word = SplitMix64(SeedState);
+    }
+
+    for(uint64 Word{0}; Word < 4; ++Word)
+    {
+        State[Word] = uint64_4{LaneState[Word]};
+    }
+
+    //every round jumps all lanes and then puts back the ones that already reached their start, lane N ends up N jumps ahead
+    for(uint64 Lane{1}; Lane < uint64_4::NumElements; ++Lane)
+    {
+        const uint64_4 Previous[4]{State[0], State[1], State[2], State[3]};
+
+        Jump();
+
+        for(uint64 Word{0}; Word < 4; ++Word)
+        {
+            for(uint64 Earlier{0}; Earlier < Lane; ++Earlier)
+            {
+                State[Word][Earlier] = Previous[Word][Earlier];
+            }
+        }
+    }
+}
+
+void Simd::FRandom::Jump()
+{
+    ApplyJump(JumpPolynomial);
+}
+
+void Simd::FRandom::LongJump()
+{
+    ApplyJump(LongJumpPolynomial);
+}
+
+void Simd::FRandom::ApplyJump(const uint64 (&Polynomial)[4])
+{
+    uint64_4 Jumped[4];
+
+    for(const uint64 Coefficients : Polynomial)
+    {
+        for(int32 Bit{0}; Bit < 64; ++Bit)
+        {
+            if(Coefficients & (1ull << Bit))
+            {
+                for(uint64 Word{0}; Word < 4; ++Word)
+                {
+                    Jumped[Word] ^= State[Word];
+                }
+            }
+
+            Next();
+        }
+    }
+
+    for(uint64 Word{0}; Word < 4; ++Word)
+    {
+        State[Word] = Jumped[Word];
+    }
+}
+
+void Simd::FRandom::Fill(uint64* Data, const uint64 Num)
+{
+    FillWith<uint64_4>(Data, Num, [this]()
+    {
+        return Next();
+    });
+}
+
+void Simd::FRandom::Fill(uint32* Data, const uint64 Num)
+{
+    FillWith<uint32_8>(Data, Num, [this]()
+    {
+        return NextUInt32();
+    });
+}
+
+void Simd::FRandom::FillUniform(float32* Data, const uint64 Num)
+{
+    FillWith<float32_8>(Data, Num, [this]()
+    {
+        return NextFloat32();
+    });
+}
+
+void Simd::FRandom::FillUniform(float64* Data, const uint64 Num)
+{
+    FillWith<float64_4>(Data, Num, [this]()
+    {
+        return NextFloat64();
+    });
+}
@@ -0,0 +1,150 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "Simd.h"
+
+namespace Simd
+{
+
+    //Four independent xoshiro256** streams, one per uint64_4 lane, so every call produces a whole register of random bits.
+    //The lanes start 2^128 steps apart on the same sequence, so they never overlap
+    class FRandom final
+    {
+    public:
+
+        //Seeds the first lane through SplitMix64, the other lanes are jumps of it
+        explicit FRandom(const uint64 Seed);
+
+        //256 random bits, 64 per lane
+        ATTRAVX uint64_4 Next()
+        {
+            const uint64_4 Scrambled{State[1] + ShiftLeftBits<2>(State[1])};
+            const uint64_4 Result{RotateLeftBits<7>(Scrambled) + ShiftLeftBits<3>(RotateLeftBits<7>(Scrambled))};
+
+            const uint64_4 Shifted{ShiftLeftBits<17>(State[1])};
+
+            State[2] ^= State[0];
+            State[3] ^= State[1];
+            State[1] ^= State[2];
+            State[0] ^= State[3];
+            State[2] ^= Shifted;
+            State[3] = RotateLeftBits<45>(State[3]);
+
+            return Result;
+        }
+
+        ATTRAVX uint32_8 NextUInt32()
+        {
+            return Reinterpret<uint32_8>(Next());
+        }
+
+        //Uniform in [0, 1), the upper 24 bits of every 32 bit lane scaled by 2^-24
+        ATTRAVX float32_8 NextFloat32()
+        {
+            const int32_8 Mantissa{Reinterpret<int32_8>(ShiftRightBits<8>(NextUInt32()))};
+            return Convert<float32_8>(Mantissa) * float32_8{0x1p-24f};
+        }
+
+        //Uniform in [0, 1), the upper 52 bits become the mantissa of a double in [1, 2) and the 1 is subtracted again
+        ATTRAVX float64_4 NextFloat64()
+        {
+            const uint64_4 Bits{ShiftRightBits<12>(Next()) | uint64_4{0x3FF0000000000000ull}};
+            return Reinterpret<float64_4>(Bits) - float64_4{1.0};
+        }
+
+        //Uniform in [0, Range) with Lemire's multiply and reject, Range must not be 0. A lane is drawn again only when the low half
+        //of its product lands below 2^32 % Range, which for most ranges almost never happens
+        ATTRAVX uint32_8 NextBounded(const uint32 Range)
+        {
+            const uint32_8 RangeVector{Range};
+            const uint32_8 Threshold{static_cast<uint32>(-Range % Range)};
+
+            uint32_8 Random{NextUInt32()};
+            uint32_8 Result{MultiplyHigh(Random, RangeVector)};
+
+            TVectorMask<uint32_8> Rejected{(Random * RangeVector) < Threshold};
+            while EXPECT(Rejected.Any(), false)
+            {
+                Random = NextUInt32();
+
+                Result = Select(Rejected, MultiplyHigh(Random, RangeVector), Result);
+                Rejected &= (Random * RangeVector) < Threshold;
+            }
+
+            return Result;
+        }
+
+        ATTRAVX uint64_4 NextBounded(const uint64 Range)
+        {
+            const uint64_4 RangeVector{Range};
+            const uint64_4 Threshold{static_cast<uint64>(-Range % Range)};
+
+            uint64_4 Random{Next()};
+            uint64_4 Result{MultiplyHigh(Random, RangeVector)};
+
+            TVectorMask<uint64_4> Rejected{(Random * RangeVector) < Threshold};
+            while EXPECT(Rejected.Any(), false)
+            {
+                Random = Next();
+
+                Result = Select(Rejected, MultiplyHigh(Random, RangeVector), Result);
+                Rejected &= (Random * RangeVector) < Threshold;
+            }
+
+            return Result;
+        }
+
+        //Advances every lane by 2^128 steps
+        void Jump();
+
+        //Advances every lane by 2^192 steps. Copy the generator for a thread and then LongJump the original, every copy gets
+        //its own four streams that can each produce 2^128 values before running into the next
+        void LongJump();
+
+        //Fills Data with Num random values
+        void Fill(uint64* Data, const uint64 Num);
+        void Fill(uint32* Data, const uint64 Num);
+
+        //Fills Data with Num values uniform in [0, 1)
+        void FillUniform(float32* Data, const uint64 Num);
+        void FillUniform(float64* Data, const uint64 Num);
+
+    private:
+
+        void ApplyJump(const uint64 (&Polynomial)[4]);
+
+        template<typename TVector, typename TGenerate>
+        ATTRAVX void FillWith(typename TVector::ElementType* Data, const uint64 Num, TGenerate Generate)
+        {
+            uint64 Index{0};
+            for(; Index + TVector::NumElements <= Num; Index += TVector::NumElements)
+            {
+                const TVector Values{Generate()};
+                Memory::Copy(Data + Index, Values.ToPtr(), sizeof(TVector));
+            }
+
+            if(Index < Num)
+            {
+                const TVector Values{Generate()};
+                Memory::Copy(Data + Index, Values.ToPtr(), (Num - Index) * ElementSize<TVector>());
+            }
+        }
+
+        uint64_4 State[4];
+
+    };
+
+}
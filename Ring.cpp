@@ -0,0 +1,48 @@
+#include "Ring.h"
+
+#include <climits>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+Ring::FEventCount::FEventCount()
+    : Epoch(0)
+    , NumWaiters(0)
+{
+}
+
+uint32 Ring::FEventCount::PrepareWait()
+{
+    //sequentially consistent so either the producer sees the waiter or the waiter's second check sees the producer's item
+    NumWaiters.fetch_add(1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    return Epoch.load(std::memory_order_seq_cst);
+}
+
+void Ring::FEventCount::CancelWait()
+{
+    NumWaiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void Ring::FEventCount::Wait(const uint32 Key)
+{
+    //returns at once when the epoch already moved past Key, spurious wakeups just make the caller check again
+    syscall(SYS_futex, reinterpret_cast<uint32*>(&Epoch), FUTEX_WAIT_PRIVATE, Key, nullptr, nullptr, 0);
+
+    NumWaiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void Ring::FEventCount::NotifyAll()
+{
+    //orders the item the caller just published before the read of the waiters, pairs with the one in PrepareWait
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if(NumWaiters.load(std::memory_order_relaxed) == 0)
+    {
+        return;
+    }
+
+    Epoch.fetch_add(1, std::memory_order_seq_cst);
+    syscall(SYS_futex, reinterpret_cast<uint32*>(&Epoch), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
@@ -0,0 +1,448 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <type_traits>
+#include "Memory.h"
+
+//Bounded lock free rings for handing batches between threads. Items are copied bitwise like everywhere else in the library, so
+//registers and FStaticStrings can be queued directly. The indices owned by different threads sit on their own cache lines
+namespace Ring
+{
+
+    inline constexpr uint64 CacheLineSize{64};
+
+    //Lets consumers sleep on a futex until a producer signals. A producer pays one fence and one load when nobody waits.
+    //A waiter registers first, then checks its condition again and only sleeps if the epoch hasn't moved since it registered
+    class FEventCount final
+    {
+    public:
+
+        FEventCount();
+
+        //Returns the key for Wait, the caller has to check its condition again before waiting on it
+        uint32 PrepareWait();
+
+        //For when the check after PrepareWait succeeded
+        void CancelWait();
+
+        void Wait(const uint32 Key);
+
+        void NotifyAll();
+
+    private:
+
+        std::atomic<uint32> Epoch;
+        std::atomic<uint32> NumWaiters;
+
+    };
+
+    //One producer and one consumer thread. Both sides move whole runs of items with one copy and one release store per batch,
+    //and keep a cached copy of the other side's index so the shared cache line is only read when the ring looks full or empty
+    template<typename T>
+    class TSpscRing final
+    {
+    public:
+
+        static_assert(std::is_trivially_destructible_v<T>);
+
+        //The capacity is MinCapacity rounded up to a power of two. Without bBlocking PopWait spins instead of sleeping and Push skips the notify
+        explicit TSpscRing(const uint64 MinCapacity, const bool bInBlocking = false);
+
+        ~TSpscRing();
+
+        TSpscRing(const TSpscRing&) = delete;
+        TSpscRing& operator=(const TSpscRing&) = delete;
+
+        //Producer only. Copies as many of the Num items as fit and returns how many that were
+        uint64 Push(const T* Items, const uint64 Num);
+
+        //Consumer only. Copies up to MaxItems items to Out and returns how many
+        uint64 Pop(T* Out, const uint64 MaxItems);
+
+        //Consumer only. Like Pop, but waits for at least one item. Returns 0 only once the ring is closed and drained
+        uint64 PopWait(T* Out, const uint64 MaxItems);
+
+        //Producer only. Wakes the consumer for good once the remaining items are popped
+        void Close();
+
+        inline uint64 Capacity() const
+        {
+            return Mask + 1;
+        }
+
+    private:
+
+        inline static constexpr uint64 ItemAlignment{alignof(T) > CacheLineSize ? alignof(T) : CacheLineSize};
+
+        //copies Num items between the ring starting at Index and Items, in two runs when the range wraps
+        void CopyIn(const uint64 Index, const T* Items, const uint64 Num);
+        void CopyOut(const uint64 Index, T* Out, const uint64 Num) const;
+
+        struct alignas(CacheLineSize) FProducer
+        {
+            std::atomic<uint64> Tail;
+            uint64 CachedHead;
+        };
+
+        struct alignas(CacheLineSize) FConsumer
+        {
+            std::atomic<uint64> Head;
+            uint64 CachedTail;
+        };
+
+        FProducer Producer;
+        FConsumer Consumer;
+
+        alignas(CacheLineSize) T* Items;
+        uint64 Mask;
+        bool bBlocking;
+        std::atomic<bool> bClosed;
+        FEventCount NotEmpty;
+
+    };
+
+    //Any number of producers and consumers, Dmitry Vyukov's bounded queue with a block of up to BlockSize items in every cell.
+    //The sequence number of a cell says whose turn it is, so claiming a cell is one CAS on a shared position and moving a whole
+    //block costs no more atomics than moving a single item
+    template<typename T, uint32 BlockSize>
+    class TMpmcRing final
+    {
+    public:
+
+        static_assert(std::is_trivially_destructible_v<T>);
+        static_assert(BlockSize > 0);
+
+        //The number of cells is MinCells rounded up to a power of two, at least 2
+        explicit TMpmcRing(const uint64 MinCells, const bool bInBlocking = false);
+
+        ~TMpmcRing();
+
+        TMpmcRing(const TMpmcRing&) = delete;
+        TMpmcRing& operator=(const TMpmcRing&) = delete;
+
+        //Copies Num items, at most BlockSize, into one cell. Returns false when every cell is full
+        bool Push(const T* Items, const uint32 Num);
+
+        //Copies the block of one cell to Out, which needs room for BlockSize items, and returns its size. Returns 0 when the ring is empty
+        uint32 Pop(T* Out);
+
+        //Like Pop, but waits for a block. Returns 0 only once the ring is closed and drained
+        uint32 PopWait(T* Out);
+
+        //Wakes every waiting consumer for good once the remaining blocks are popped, pushing afterwards is not allowed
+        void Close();
+
+        inline uint64 NumCells() const
+        {
+            return Mask + 1;
+        }
+
+    private:
+
+        struct alignas(CacheLineSize) FCell
+        {
+            std::atomic<uint64> Sequence;
+            uint32 Num;
+            T Items[BlockSize];
+        };
+
+        alignas(CacheLineSize) std::atomic<uint64> EnqueuePosition;
+        alignas(CacheLineSize) std::atomic<uint64> DequeuePosition;
+
+        alignas(CacheLineSize) FCell* Cells;
+        uint64 Mask;
+        bool bBlocking;
+        std::atomic<bool> bClosed;
+        FEventCount NotEmpty;
+
+    };
+
+}
+
+template<typename T>
+Ring::TSpscRing<T>::TSpscRing(const uint64 MinCapacity, const bool bInBlocking)
+    : Producer{{0}, 0}
+    , Consumer{{0}, 0}
+    , Mask(std::bit_ceil(MinCapacity > 1 ? MinCapacity : 2) - 1)
+    , bBlocking(bInBlocking)
+    , bClosed(false)
+{
+    Items = Memory::AllocateAligned<ItemAlignment, T>(Mask + 1);
+}
+
+template<typename T>
+Ring::TSpscRing<T>::~TSpscRing()
+{
+    Memory::FreeAligned<ItemAlignment>(Items);
+}
+
+template<typename T>
+void Ring::TSpscRing<T>::CopyIn(const uint64 Index, const T* Source, const uint64 Num)
+{
+    const uint64 Start{Index & Mask};
+    const uint64 First{Num < Mask + 1 - Start ? Num : Mask + 1 - Start};
+
+    Memory::Copy(Items + Start, Source, First * sizeof(T));
+    Memory::Copy(Items, Source + First, (Num - First) * sizeof(T));
+}
+
+template<typename T>
+void Ring::TSpscRing<T>::CopyOut(const uint64 Index, T* Out, const uint64 Num) const
+{
+    const uint64 Start{Index & Mask};
+    const uint64 First{Num < Mask + 1 - Start ? Num : Mask + 1 - Start};
+
+    Memory::Copy(Out, Items + Start, First * sizeof(T));
+    Memory::Copy(Out + First, Items, (Num - First) * sizeof(T));
+}
+
+template<typename T>
+uint64 Ring::TSpscRing<T>::Push(const T* Source, const uint64 Num)
+{
+    const uint64 Tail{Producer.Tail.load(std::memory_order_relaxed)};
+
+    if(Tail + Num - Producer.CachedHead > Mask + 1)
+    {
+        Producer.CachedHead = Consumer.Head.load(std::memory_order_acquire);
+    }
+
+    const uint64 Free{Mask + 1 - (Tail - Producer.CachedHead)};
+    const uint64 Count{Num < Free ? Num : Free};
+
+    if(Count == 0)
+    {
+        return 0;
+    }
+
+    CopyIn(Tail, Source, Count);
+    Producer.Tail.store(Tail + Count, std::memory_order_release);
+
+    if(bBlocking)
+    {
+        NotEmpty.NotifyAll();
+    }
+
+    return Count;
+}
+
+template<typename T>
+uint64 Ring::TSpscRing<T>::Pop(T* Out, const uint64 MaxItems)
+{
+    const uint64 Head{Consumer.Head.load(std::memory_order_relaxed)};
+
+    if(Consumer.CachedTail - Head < MaxItems)
+    {
+        Consumer.CachedTail = Producer.Tail.load(std::memory_order_acquire);
+    }
+
+    const uint64 Available{Consumer.CachedTail - Head};
+    const uint64 Count{MaxItems < Available ? MaxItems : Available};
+
+    if(Count == 0)
+    {
+        return 0;
+    }
+
+    CopyOut(Head, Out, Count);
+    Consumer.Head.store(Head + Count, std::memory_order_release);
+
+    return Count;
+}
+
+template<typename T>
+uint64 Ring::TSpscRing<T>::PopWait(T* Out, const uint64 MaxItems)
+{
+    for(;;)
+    {
+        //the closed flag is read before popping, items pushed before Close are still seen by the Pop after it
+        const bool bWasClosed{bClosed.load(std::memory_order_acquire)};
+
+        const uint64 Count{Pop(Out, MaxItems)};
+        if(Count > 0 || bWasClosed)
+        {
+            return Count;
+        }
+
+        if(!bBlocking)
+        {
+            __builtin_ia32_pause();
+            continue;
+        }
+
+        const uint32 Key{NotEmpty.PrepareWait()};
+
+        if(bClosed.load(std::memory_order_acquire) || Producer.Tail.load(std::memory_order_acquire) != Consumer.Head.load(std::memory_order_relaxed))
+        {
+            NotEmpty.CancelWait();
+            continue;
+        }
+
+        NotEmpty.Wait(Key);
+    }
+}
+
+template<typename T>
+void Ring::TSpscRing<T>::Close()
+{
+    bClosed.store(true, std::memory_order_release);
+    NotEmpty.NotifyAll();
+}
+
+template<typename T, uint32 BlockSize>
+Ring::TMpmcRing<T, BlockSize>::TMpmcRing(const uint64 MinCells, const bool bInBlocking)
+    : EnqueuePosition(0)
+    , DequeuePosition(0)
+    , Mask(std::bit_ceil(MinCells > 1 ? MinCells : 2) - 1)
+    , bBlocking(bInBlocking)
+    , bClosed(false)
+{
+    Cells = Memory::AllocateAligned<alignof(FCell), FCell>(Mask + 1);
+
+    //cell N is free for the producer that claims position N
+    for(uint64 Cell{0}; Cell <= Mask; ++Cell)
+    {
+        new (&Cells[Cell].Sequence) std::atomic<uint64>{Cell};
+    }
+}
+
+template<typename T, uint32 BlockSize>
+Ring::TMpmcRing<T, BlockSize>::~TMpmcRing()
+{
+    Memory::FreeAligned<alignof(FCell)>(Cells);
+}
+
+template<typename T, uint32 BlockSize>
+bool Ring::TMpmcRing<T, BlockSize>::Push(const T* Source, const uint32 Num)
+{
+    uint64 Position{EnqueuePosition.load(std::memory_order_relaxed)};
+    FCell* Cell;
+
+    for(;;)
+    {
+        Cell = &Cells[Position & Mask];
+
+        const uint64 Sequence{Cell->Sequence.load(std::memory_order_acquire)};
+        const int64 Difference{static_cast<int64>(Sequence - Position)};
+
+        if(Difference == 0)
+        {
+            if(EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(Difference < 0)
+        {
+            //the cell still holds the block pushed one lap earlier
+            return false;
+        }
+        else
+        {
+            Position = EnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    Memory::Copy(Cell->Items, Source, Num * sizeof(T));
+    Cell->Num = Num;
+    Cell->Sequence.store(Position + 1, std::memory_order_release);
+
+    if(bBlocking)
+    {
+        NotEmpty.NotifyAll();
+    }
+
+    return true;
+}
+
+template<typename T, uint32 BlockSize>
+uint32 Ring::TMpmcRing<T, BlockSize>::Pop(T* Out)
+{
+    uint64 Position{DequeuePosition.load(std::memory_order_relaxed)};
+    FCell* Cell;
+
+    for(;;)
+    {
+        Cell = &Cells[Position & Mask];
+
+        const uint64 Sequence{Cell->Sequence.load(std::memory_order_acquire)};
+        const int64 Difference{static_cast<int64>(Sequence - (Position + 1))};
+
+        if(Difference == 0)
+        {
+            if(DequeuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(Difference < 0)
+        {
+            return 0;
+        }
+        else
+        {
+            Position = DequeuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    const uint32 Num{Cell->Num};
+    Memory::Copy(Out, Cell->Items, Num * sizeof(T));
+
+    //hands the cell to the producer one lap ahead
+    Cell->Sequence.store(Position + Mask + 1, std::memory_order_release);
+
+    return Num;
+}
+
+template<typename T, uint32 BlockSize>
+uint32 Ring::TMpmcRing<T, BlockSize>::PopWait(T* Out)
+{
+    for(;;)
+    {
+        const bool bWasClosed{bClosed.load(std::memory_order_acquire)};
+
+        const uint32 Num{Pop(Out)};
+        if(Num > 0 || bWasClosed)
+        {
+            return Num;
+        }
+
+        if(!bBlocking)
+        {
+            __builtin_ia32_pause();
+            continue;
+        }
+
+        const uint32 Key{NotEmpty.PrepareWait()};
+
+        //a block is ready when the cell at the dequeue position has been published
+        const uint64 Position{DequeuePosition.load(std::memory_order_relaxed)};
+        if(bClosed.load(std::memory_order_acquire) || Cells[Position & Mask].Sequence.load(std::memory_order_acquire) == Position + 1)
+        {
+            NotEmpty.CancelWait();
+            continue;
+        }
+
+        NotEmpty.Wait(Key);
+    }
+}
+
+template<typename T, uint32 BlockSize>
+void Ring::TMpmcRing<T, BlockSize>::Close()
+{
+    bClosed.store(true, std::memory_order_release);
+    NotEmpty.NotifyAll();
+}
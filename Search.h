@@ -0,0 +1,266 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <limits>
+#include "Simd.h"
+#include "Math.h"
+
+namespace Simd
+{
+
+    //Returns how many of the first Num elements in Data are less than Key
+    template<typename TVector>
+    ATTRAVX uint64 CountLesser(const typename TVector::ElementType* Data, const uint64 Num, const typename TVector::ElementType Key)
+    {
+        static_assert(ElementSize<TVector>() >= 4, "the compare mask needs one bit per lane");
+
+        const TVector KeyVector{Key};
+
+        uint64 Count{0};
+        uint64 Index{0};
+
+        for(; Index + TVector::NumElements <= Num; Index += TVector::NumElements)
+        {
+            Count += Math::NumActiveBits(static_cast<uint32>(CompareGreater(KeyVector, Load<TVector>(Data + Index))));
+        }
+
+        for(; Index < Num; ++Index)
+        {
+            Count += Data[Index] < Key;
+        }
+
+        return Count;
+    }
+
+    //Returns the index of the first element in the sorted Data that is not less than Key, same result as std::lower_bound.
+    //Narrows the range with a branchless binary search and finishes the last two registers worth of elements with a vector compare
+    template<typename TVector>
+    uint64 LowerBound(const typename TVector::ElementType* Data, const uint64 Num, const typename TVector::ElementType Key)
+    {
+        constexpr uint64 Window{TVector::NumElements * 2};
+
+        uint64 Base{0};
+        uint64 Length{Num};
+
+        while(Length > Window)
+        {
+            const uint64 Half{Length / 2};
+            Base = Data[Base + Half] < Key ? Base + Half : Base;
+            Length -= Half;
+        }
+
+        return Base + CountLesser<TVector>(Data + Base, Length, Key);
+    }
+
+    //Batched LowerBound, writes the result for every key in Keys to Out.
+    //Runs a group of independent searches in lockstep and prefetches each next probe so the cache misses overlap
+    template<typename TVector>
+    void LowerBound(const typename TVector::ElementType* Data, const uint64 Num, const typename TVector::ElementType* Keys, const uint64 NumKeys, uint64* Out)
+    {
+        constexpr uint64 Window{TVector::NumElements * 2};
+        constexpr uint64 NumInFlight{16};
+
+        for(uint64 First{0}; First < NumKeys; First += NumInFlight)
+        {
+            const uint64 NumInGroup{NumKeys - First < NumInFlight ? NumKeys - First : NumInFlight};
+
+            uint64 Bases[NumInFlight]{};
+            uint64 Length{Num};
+
+            while(Length > Window)
+            {
+                const uint64 Half{Length / 2};
+                const uint64 NextHalf{(Length - Half) / 2};
+
+                for(uint64 Search{0}; Search < NumInGroup; ++Search)
+                {
+                    Bases[Search] = Data[Bases[Search] + Half] < Keys[First + Search] ? Bases[Search] + Half : Bases[Search];
+                    __builtin_prefetch(Data + Bases[Search] + NextHalf);
+                }
+
+                Length -= Half;
+            }
+
+            for(uint64 Search{0}; Search < NumInGroup; ++Search)
+            {
+                Out[First + Search] = Bases[Search] + CountLesser<TVector>(Data + Bases[Search], Length, Keys[First + Search]);
+            }
+        }
+    }
+
+    //Sorted keys laid out as an implicit B-tree where every node fills one cache line. Searching it is a k-ary search,
+    //each level compares the broadcast key against a whole node and the popcount of the mask picks the child
+    template<typename TVector>
+    class TSearchTree final
+    {
+    public:
+
+        using ElementType = typename TVector::ElementType;
+
+        static_assert(ElementSize<TVector>() >= 4, "the compare mask needs one bit per lane");
+
+        inline static const constinit uint64 NumNodeKeys{64 / sizeof(ElementType)};
+        inline static const constinit uint64 NumNodeVectors{NumNodeKeys / TVector::NumElements};
+
+        explicit TSearchTree(const ElementType* SortedData, const uint64 Num);
+
+        ~TSearchTree();
+
+        TSearchTree(const TSearchTree&) = delete;
+        TSearchTree& operator=(const TSearchTree&) = delete;
+
+        //Returns the index in the source array of the first element not less than Key, or Num if there is none
+        uint64 LowerBound(const ElementType Key) const;
+
+        //Batched LowerBound, walks a group of searches down the tree together and prefetches their next nodes
+        void LowerBound(const ElementType* SearchKeys, const uint64 NumSearchKeys, uint64* Out) const;
+
+        inline uint64 Num() const
+        {
+            return NumData;
+        }
+
+    private:
+
+        void Build(const ElementType* SortedData, const uint64 Node, uint64& SortedIndex);
+
+        ATTRAVX uint64 NodeLesser(const uint64 Node, const TVector& KeyVector) const
+        {
+            const ElementType* NodeKeys{Keys + Node * NumNodeKeys};
+
+            uint32 Mask{0};
+            for(uint64 Index{0}; Index < NumNodeVectors; ++Index)
+            {
+                Mask |= static_cast<uint32>(CompareGreater(KeyVector, Load<TVector>(NodeKeys + Index * TVector::NumElements))) << (Index * TVector::NumElements);
+            }
+
+            return Math::NumActiveBits(Mask);
+        }
+
+        ElementType* Keys;
+        uint64* Ranks;
+
+        uint64 NumData;
+        uint64 NumNodes;
+        uint64 Height;
+
+    };
+
+}
+
+template<typename TVector>
+Simd::TSearchTree<TVector>::TSearchTree(const ElementType* SortedData, const uint64 Num)
+    : NumData(Num)
+    , NumNodes((Num + NumNodeKeys - 1) / NumNodeKeys)
+    , Height(0)
+{
+    Keys = Memory::AllocateAligned<64, ElementType>(NumNodes * NumNodeKeys);
+    Ranks = Memory::AllocateAligned<64, uint64>(NumNodes * NumNodeKeys);
+
+    uint64 SortedIndex{0};
+    Build(SortedData, 0, SortedIndex);
+
+    for(uint64 LevelStart{0}; LevelStart < NumNodes; LevelStart = LevelStart * (NumNodeKeys + 1) + 1)
+    {
+        ++Height;
+    }
+}
+
+template<typename TVector>
+Simd::TSearchTree<TVector>::~TSearchTree()
+{
+    Memory::FreeAligned<64>(Keys);
+    Memory::FreeAligned<64>(Ranks);
+}
+
+template<typename TVector>
+void Simd::TSearchTree<TVector>::Build(const ElementType* SortedData, const uint64 Node, uint64& SortedIndex)
+{
+    if(Node >= NumNodes)
+    {
+        return;
+    }
+
+    //in order traversal, the slots left over after the last element are padded with the largest value so they sort last
+    for(uint64 Index{0}; Index < NumNodeKeys; ++Index)
+    {
+        Build(SortedData, Node * (NumNodeKeys + 1) + Index + 1, SortedIndex);
+
+        const bool bIsPadding{SortedIndex >= NumData};
+
+        Keys[Node * NumNodeKeys + Index] = bIsPadding ? std::numeric_limits<ElementType>::max() : SortedData[SortedIndex];
+        Ranks[Node * NumNodeKeys + Index] = bIsPadding ? NumData : SortedIndex;
+
+        ++SortedIndex;
+    }
+
+    Build(SortedData, Node * (NumNodeKeys + 1) + NumNodeKeys + 1, SortedIndex);
+}
+
+template<typename TVector>
+uint64 Simd::TSearchTree<TVector>::LowerBound(const ElementType Key) const
+{
+    const TVector KeyVector{Key};
+
+    //the deepest node that still has a key not less than Key holds the answer
+    uint64 Slot{~0ull};
+    uint64 Node{0};
+
+    while(Node < NumNodes)
+    {
+        const uint64 Child{NodeLesser(Node, KeyVector)};
+
+        Slot = Child < NumNodeKeys ? Node * NumNodeKeys + Child : Slot;
+        Node = Node * (NumNodeKeys + 1) + Child + 1;
+    }
+
+    return Slot == ~0ull ? NumData : Ranks[Slot];
+}
+
+template<typename TVector>
+void Simd::TSearchTree<TVector>::LowerBound(const ElementType* SearchKeys, const uint64 NumSearchKeys, uint64* Out) const
+{
+    constexpr uint64 NumInFlight{16};
+
+    for(uint64 First{0}; First < NumSearchKeys; First += NumInFlight)
+    {
+        const uint64 NumInGroup{NumSearchKeys - First < NumInFlight ? NumSearchKeys - First : NumInFlight};
+
+        uint64 Nodes[NumInFlight]{};
+        uint64 Slots[NumInFlight];
+        Memory::Set(Slots, 0xFF, sizeof(Slots));
+
+        for(uint64 Level{0}; Level < Height; ++Level)
+        {
+            for(uint64 Search{0}; Search < NumInGroup; ++Search)
+            {
+                if(Nodes[Search] < NumNodes)
+                {
+                    const uint64 Child{NodeLesser(Nodes[Search], TVector{SearchKeys[First + Search]})};
+
+                    Slots[Search] = Child < NumNodeKeys ? Nodes[Search] * NumNodeKeys + Child : Slots[Search];
+                    Nodes[Search] = Nodes[Search] * (NumNodeKeys + 1) + Child + 1;
+
+                    __builtin_prefetch(Keys + Nodes[Search] * NumNodeKeys);
+                }
+            }
+        }
+
+        for(uint64 Search{0}; Search < NumInGroup; ++Search)
+        {
+            Out[First + Search] = Slots[Search] == ~0ull ? NumData : Ranks[Slots[Search]];
+        }
+    }
+}
@@ -14,6 +14,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #pragma once
 
 #include <concepts>
+#include <limits>
+#include <utility>
 #include "Memory.h"
 
 #define ATTRAVX inline __attribute__((always_inline, nodebug, flatten))
@@ -24,8 +26,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #ifdef __AVX2__
 #define AVX256 __AVX2__
 #endif
-#ifdef __AVX512__
-#define AVX512 __AVX512__ //not yet implemented
+#if defined(__AVX512F__) && defined(__AVX512VL__) && defined(__AVX512BW__) && defined(__AVX512CD__) && defined(__AVX512VPOPCNTDQ__) && defined(__AVX512BITALG__)
+#define AVX512 __AVX512F__
 #endif
 
 namespace Simd
@@ -117,6 +119,9 @@ namespace Simd
         using float32_8 = Vector32<float32>;
         using float64_4 = Vector32<float64>;
 
+        using float16_16 = Vector32<float16>;
+        using bfloat16_16 = Vector32<bfloat16>;
+
         static_assert(alignof(char8_32) == 32);
         static_assert(alignof(int8_32) == 32);
         static_assert(alignof(uint8_32) == 32);
@@ -132,6 +137,9 @@ namespace Simd
 
         static_assert(alignof(float32_8) == 32);
         static_assert(alignof(float64_4) == 32);
+
+        static_assert(alignof(float16_16) == 32);
+        static_assert(alignof(bfloat16_16) == 32);
     }
 
     using char8_32 = Internal::TVectorRegister<Internal::char8_32, char8>;
@@ -150,6 +158,10 @@ namespace Simd
     using float32_8 = Internal::TVectorRegister<Internal::float32_8, float32>;
     using float64_4 = Internal::TVectorRegister<Internal::float64_4, float64>;
 
+    //half precision storage, widen to float32_8 for arithmetic
+    using float16_16 = Internal::TVectorRegister<Internal::float16_16, float16>;
+    using bfloat16_16 = Internal::TVectorRegister<Internal::bfloat16_16, bfloat16>;
+
 #endif //AVX256
 
     template<typename TVector>
@@ -172,6 +184,25 @@ namespace Simd
 #endif
     }
 
+    //whether the running cpu has every extension this file was compiled for, call before any vector code runs
+    inline bool IsSupportedByCpu()
+    {
+        __builtin_cpu_init();
+
+        bool bSupported{true};
+#ifdef AVX128
+        bSupported = bSupported && __builtin_cpu_supports("avx");
+#endif
+#ifdef AVX256
+        bSupported = bSupported && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") && __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("pclmul");
+#endif
+#ifdef AVX512
+        bSupported = bSupported && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512bw")
+            && __builtin_cpu_supports("avx512cd") && __builtin_cpu_supports("avx512vpopcntdq") && __builtin_cpu_supports("avx512bitalg");
+#endif
+        return bSupported;
+    }
+
     template<typename TSource, int32... Control>
     ATTRAVX auto ShuffleVector(const TSource& Source)
     {
@@ -318,7 +349,7 @@ namespace Simd
             }
             else if constexpr(ElementSize<TVector>() == 8)
             {
-                return __builtin_ia32_movmskpd256(LHS.Vector == RHS.Vector);
+                return __builtin_ia32_movmskpd256(LHS.Vector > RHS.Vector);
             }
         }
         else if constexpr(alignof(TVector) == 16)
@@ -353,7 +384,7 @@ namespace Simd
             }
             else if constexpr(ElementSize<TVector>() == 8)
             {
-                return __builtin_ia32_movmskpd256(LHS.Vector == RHS.Vector);
+                return __builtin_ia32_movmskpd256(LHS.Vector >= RHS.Vector);
             }
         }
         else if constexpr(alignof(TVector) == 16)
@@ -585,51 +616,21 @@ namespace Simd
         }
     }
 
+    //pabs for 8 to 32 bit lanes, vpabsq for 64 bit lanes with AVX512VL and a compare and blend without it, floats clear the sign bit.
+    //Clang dropped the per width pabs builtins in favour of this one
     template<typename TVector>
     ATTRAVX constexpr TVector Absolute(const TVector& Target)
     {
-        if constexpr(alignof(TVector) == 32)
-        {
-            if constexpr(ElementSize<TVector>() == 1)
-            {
-                return TVector{__builtin_ia32_pabsb256(Target.Vector)};
-            }
-            else if constexpr(ElementSize<TVector>() == 2)
-            {
-                return TVector{__builtin_ia32_pabsw256(Target.Vector)};
-            }
-            else if constexpr(ElementSize<TVector>() == 4)
-            {
-                return TVector{__builtin_ia32_pabsd256(Target.Vector)};
-            }
-            else if constexpr(ElementSize<TVector>() == 8)
-            {
-#ifdef AVX512
-                return TVector{__builtin_ia32_pabsq256(Target.Vector)};
-#endif
-            }
-        }
-        else if constexpr(alignof(TVector) == 16)
-        {
-            if constexpr(ElementSize<TVector>() == 1)
-            {
-                return TVector{__builtin_ia32_pabsb128(Target.Vector)};
-            }
-            else if constexpr(ElementSize<TVector>() == 2)
-            {
-                return TVector{__builtin_ia32_pabsw128(Target.Vector)};
-            }
-            else if constexpr(ElementSize<TVector>() == 4)
-            {
-                return TVector{__builtin_ia32_pabsd128(Target.Vector)};
-            }
-            else if constexpr(ElementSize<TVector>() == 8)
-            {
-#ifdef AVX512
-                return TVector{__builtin_ia32_pabsq128(Target.Vector)};
-#endif
-            }
-        }
+        return TVector{__builtin_elementwise_abs(Target.Vector)};
+    }
+
+    //vfmadd, LHS * RHS + Addend rounded once. The compiler only contracts a multiply and an add written in the same expression
+    template<typename TVector>
+    ATTRAVX constexpr TVector FusedMultiplyAdd(const TVector& LHS, const TVector& RHS, const TVector& Addend)
+    {
+        static_assert(std::is_floating_point_v<typename TVector::ElementType>);
+
+        return TVector{__builtin_elementwise_fma(LHS.Vector, RHS.Vector, Addend.Vector)};
     }
 
     template<typename TVector, typename DataType = typename TVector::ElementType>
@@ -646,6 +647,20 @@ namespace Simd
         return TVector{reinterpret_cast<InternalVector>(reinterpret_cast<const FSource*>(Data)->Vector)};
     }
 
+    //the register at First of an array of Num elements, zero padded when fewer than a register's worth is left
+    template<typename TVector, typename DataType = typename TVector::ElementType>
+    ATTRAVX TVector LoadChunk(const DataType* Data, const uint64 Num, const uint64 First)
+    {
+        if EXPECT(Num - First >= TVector::NumElements, true)
+        {
+            return Load<TVector>(Data + First);
+        }
+
+        TVector Chunk{};
+        Memory::Copy(Chunk.ToPtr(), Data + First, (Num - First) * sizeof(DataType));
+        return Chunk;
+    }
+
     template<typename TVector>
     ATTRAVX TVector ShuffleLeft(const TVector& Source, const int32 ShuffleAmount)
     {
@@ -662,288 +677,1643 @@ namespace Simd
         return ShuffleLeft(Source, ShuffleAmount * -1);
     }
 
+    //The lane shifts below move the bits inside every lane, unlike operator<< and operator>> which move whole lanes.
+    //Amounts must be less than the lane width in bits
+
     namespace Internal
     {
-
-        template<typename InVectorType, typename InElementType>
-        class alignas(InVectorType) TVectorRegister final
+        template<typename TVector, typename TView>
+        ATTRAVX TView ViewAs(const TVector& Target)
         {
-        public:
-
-            using VectorType = InVectorType;
-            using ElementType = InElementType;
+            return reinterpret_cast<TView>(Target.Vector);
+        }
 
-            inline static const constinit uint64 NumElements = []() consteval -> uint64
-            {
-                return sizeof(VectorType) / sizeof(ElementType);
-            }();
+        template<typename TVector, typename TView>
+        ATTRAVX TVector MakeFromView(const TView& View)
+        {
+            return TVector{reinterpret_cast<typename TVector::VectorType>(View)};
+        }
 
-            inline static const constinit int32 ComparisonMask = []() consteval -> int32
+        template<typename TVector>
+        ATTRAVX TVector LogicalShiftLeft(const TVector& Target, const int32 Amount)
+        {
+            if constexpr(alignof(TVector) == 32)
             {
-                if constexpr(alignof(TVectorRegister) == 32)
+                if constexpr(ElementSize<TVector>() == 1)
                 {
-                    switch(NumElements)
-                    {
-                        case 32: return (int32)0b11111111111111111111111111111111;
-                        case 16: return (int32)0b11111111111111111111111111111111;
-                        case 8:  return (int32)0b00000000000000000000000011111111;
-                        case 4:  return (int32)0b00000000000000000000000000001111;
-                        case 2:  return (int32)0b00000000000000000000000000000011;
-                        default: ASSERT(false); return 0;
-                    }
+                    //there is no byte shift, shift the 16 bit pairs and clear the bits that crossed into the next byte
+                    const TVector Shifted{MakeFromView<TVector>(__builtin_ia32_psllwi256(ViewAs<TVector, int16_16>(Target), Amount))};
+                    return TVector{Shifted.Vector & static_cast<typename TVector::ElementType>(0xFF << Amount)};
                 }
-                else if constexpr(alignof(TVectorRegister) == 16)
+                else if constexpr(ElementSize<TVector>() == 2)
                 {
-                    switch(NumElements)
-                    {
-                        case 16: return (int32)0b00000000000000001111111111111111;
-                        case 8:  return (int32)0b00000000000000000000000011111111;
-                        case 4:  return (int32)0b00000000000000000000000000001111;
-                        case 2:  return (int32)0b00000000000000000000000000000011;
-                        default: ASSERT(false); return 0;
-                    }
+                    return MakeFromView<TVector>(__builtin_ia32_psllwi256(ViewAs<TVector, int16_16>(Target), Amount));
+                }
+                else if constexpr(ElementSize<TVector>() == 4)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_pslldi256(ViewAs<TVector, int32_8>(Target), Amount));
+                }
+                else if constexpr(ElementSize<TVector>() == 8)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psllqi256(ViewAs<TVector, int64_4>(Target), Amount));
                 }
-            }();
-
-        public:
-
-            ATTRAVX explicit constexpr TVectorRegister(ElementType Value = static_cast<ElementType>(0))
-                : Vector(Simd::SetAll<TVectorRegister>(Value).Vector)
-            {
             }
-
-            template<typename... Elements>
-            ATTRAVX explicit constexpr TVectorRegister(Elements... ElementValues)
-                : Vector{static_cast<ElementType>(ElementValues)...}
+            else if constexpr(alignof(TVector) == 16)
             {
-                static_assert(NumElements == sizeof...(ElementValues));
+                if constexpr(ElementSize<TVector>() == 1)
+                {
+                    const TVector Shifted{MakeFromView<TVector>(__builtin_ia32_psllwi128(ViewAs<TVector, int16_8>(Target), Amount))};
+                    return TVector{Shifted.Vector & static_cast<typename TVector::ElementType>(0xFF << Amount)};
+                }
+                else if constexpr(ElementSize<TVector>() == 2)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psllwi128(ViewAs<TVector, int16_8>(Target), Amount));
+                }
+                else if constexpr(ElementSize<TVector>() == 4)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_pslldi128(ViewAs<TVector, int32_4>(Target), Amount));
+                }
+                else if constexpr(ElementSize<TVector>() == 8)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psllqi128(ViewAs<TVector, int64_2>(Target), Amount));
+                }
             }
+        }
 
-            ATTRAVX TVectorRegister(const TVectorRegister& Other)
-                : Vector(Other.Vector)
+        template<typename TVector>
+        ATTRAVX TVector LogicalShiftRight(const TVector& Target, const int32 Amount)
+        {
+            if constexpr(alignof(TVector) == 32)
             {
+                if constexpr(ElementSize<TVector>() == 1)
+                {
+                    const TVector Shifted{MakeFromView<TVector>(__builtin_ia32_psrlwi256(ViewAs<TVector, int16_16>(Target), Amount))};
+                    return TVector{Shifted.Vector & static_cast<typename TVector::ElementType>(0xFF >> Amount)};
+                }
+                else if constexpr(ElementSize<TVector>() == 2)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psrlwi256(ViewAs<TVector, int16_16>(Target), Amount));
+                }
+                else if constexpr(ElementSize<TVector>() == 4)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psrldi256(ViewAs<TVector, int32_8>(Target), Amount));
+                }
+                else if constexpr(ElementSize<TVector>() == 8)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psrlqi256(ViewAs<TVector, int64_4>(Target), Amount));
+                }
             }
-
-            ATTRAVX TVectorRegister(TVectorRegister&& Other) noexcept
-                : Vector(static_cast<VectorType&&>(Other.Vector))
+            else if constexpr(alignof(TVector) == 16)
             {
+                if constexpr(ElementSize<TVector>() == 1)
+                {
+                    const TVector Shifted{MakeFromView<TVector>(__builtin_ia32_psrlwi128(ViewAs<TVector, int16_8>(Target), Amount))};
+                    return TVector{Shifted.Vector & static_cast<typename TVector::ElementType>(0xFF >> Amount)};
+                }
+                else if constexpr(ElementSize<TVector>() == 2)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psrlwi128(ViewAs<TVector, int16_8>(Target), Amount));
+                }
+                else if constexpr(ElementSize<TVector>() == 4)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psrldi128(ViewAs<TVector, int32_4>(Target), Amount));
+                }
+                else if constexpr(ElementSize<TVector>() == 8)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psrlqi128(ViewAs<TVector, int64_2>(Target), Amount));
+                }
             }
+        }
 
-            ATTRAVX explicit constexpr TVectorRegister(const VectorType& Other)
-                : Vector(Other)
-            {
-            }
+        template<typename TVector>
+        ATTRAVX TVector ArithmeticShiftRight(const TVector& Target, const int32 Amount)
+        {
+            using ElementType = typename TVector::ElementType;
 
-            ATTRAVX explicit TVectorRegister(VectorType&& Other)
-                : Vector(static_cast<VectorType&&>(Other))
+            if constexpr(ElementSize<TVector>() == 2)
             {
+                if constexpr(alignof(TVector) == 32)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psrawi256(ViewAs<TVector, int16_16>(Target), Amount));
+                }
+                else if constexpr(alignof(TVector) == 16)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psrawi128(ViewAs<TVector, int16_8>(Target), Amount));
+                }
             }
-
-            ATTRAVX ElementType* ToPtr()
+            else if constexpr(ElementSize<TVector>() == 4)
             {
-                return Memory::AssumeAligned<alignof(VectorType)>(reinterpret_cast<ElementType*>(&Vector));
+                if constexpr(alignof(TVector) == 32)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psradi256(ViewAs<TVector, int32_8>(Target), Amount));
+                }
+                else if constexpr(alignof(TVector) == 16)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psradi128(ViewAs<TVector, int32_4>(Target), Amount));
+                }
             }
-
-            ATTRAVX const ElementType* ToPtr() const
+#ifdef AVX512
+            else if constexpr(ElementSize<TVector>() == 8)
             {
-                return Memory::AssumeAligned<alignof(VectorType)>(reinterpret_cast<const ElementType*>(&Vector));
+                if constexpr(alignof(TVector) == 32)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psraqi256(ViewAs<TVector, int64_4>(Target), Amount));
+                }
+                else if constexpr(alignof(TVector) == 16)
+                {
+                    return MakeFromView<TVector>(__builtin_ia32_psraqi128(ViewAs<TVector, int64_2>(Target), Amount));
+                }
             }
+#endif
+            else
+            {
+                //bytes and, without AVX512, quad words shift logically and then sign extend from the bit the old sign bit landed on
+                using UnsignedType = std::make_unsigned_t<ElementType>;
 
-        public:
+                const ElementType SignBit{static_cast<ElementType>(static_cast<UnsignedType>(UnsignedType{1} << (ElementSize<TVector>() * 8 - 1)) >> Amount)};
+                const TVector Shifted{LogicalShiftRight(Target, Amount)};
 
-            template<typename IndexType>
-            ATTRAVX ElementType& operator[](const IndexType Index)
-            {
-                return ToPtr()[Index];
+                return TVector{(Shifted.Vector ^ SignBit) - SignBit};
             }
+        }
+    }
 
-            template<typename IndexType>
-            ATTRAVX ElementType operator[](const IndexType Index) const
-            {
-                return Vector[Index];
-            }
+    template<typename TVector>
+    ATTRAVX TVector ShiftLeftBits(const TVector& Target, const int32 Amount)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
 
-            ATTRAVX TVectorRegister& operator=(const VectorType& Other)
-            {
-                Vector = Other;
-                return *this;
-            }
+        return Internal::LogicalShiftLeft(Target, Amount);
+    }
 
-            ATTRAVX TVectorRegister& operator=(const TVectorRegister& Other)
-            {
-                Vector = Other.Vector;
-                return *this;
-            }
+    template<int32 Amount, typename TVector>
+    ATTRAVX TVector ShiftLeftBits(const TVector& Target)
+    {
+        static_assert(Amount >= 0 && Amount < ElementSize<TVector>() * 8);
 
-            ATTRAVX TVectorRegister& operator=(TVectorRegister&& Other)
-            {
-                Vector = static_cast<VectorType&&>(Other.Vector);
-                return *this;
-            }
+        return ShiftLeftBits(Target, Amount);
+    }
 
-            ATTRAVX TVectorRegister operator+(const TVectorRegister& Other) const
-            {
-                return TVectorRegister{Vector + Other.Vector};
-            }
+    //Arithmetic for signed lanes and logical for unsigned lanes, like the scalar operator
+    template<typename TVector>
+    ATTRAVX TVector ShiftRightBits(const TVector& Target, const int32 Amount)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
 
-            ATTRAVX TVectorRegister operator-(const TVectorRegister& Other) const
-            {
-                return TVectorRegister{Vector - Other.Vector};
-            }
+        if constexpr(std::is_signed_v<typename TVector::ElementType>)
+        {
+            return Internal::ArithmeticShiftRight(Target, Amount);
+        }
+        else if constexpr(!std::is_signed_v<typename TVector::ElementType>)
+        {
+            return Internal::LogicalShiftRight(Target, Amount);
+        }
+    }
 
-            ATTRAVX TVectorRegister operator*(const TVectorRegister& Other) const
+    template<int32 Amount, typename TVector>
+    ATTRAVX TVector ShiftRightBits(const TVector& Target)
+    {
+        static_assert(Amount >= 0 && Amount < ElementSize<TVector>() * 8);
+
+        return ShiftRightBits(Target, Amount);
+    }
+
+    //Shifts in zeroes regardless of the lane type
+    template<typename TVector>
+    ATTRAVX TVector ShiftRightBitsLogical(const TVector& Target, const int32 Amount)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
+
+        return Internal::LogicalShiftRight(Target, Amount);
+    }
+
+    template<int32 Amount, typename TVector>
+    ATTRAVX TVector ShiftRightBitsLogical(const TVector& Target)
+    {
+        static_assert(Amount >= 0 && Amount < ElementSize<TVector>() * 8);
+
+        return ShiftRightBitsLogical(Target, Amount);
+    }
+
+    //Shifts in copies of the sign bit regardless of the lane type
+    template<typename TVector>
+    ATTRAVX TVector ShiftRightBitsArithmetic(const TVector& Target, const int32 Amount)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
+
+        return Internal::ArithmeticShiftRight(Target, Amount);
+    }
+
+    template<int32 Amount, typename TVector>
+    ATTRAVX TVector ShiftRightBitsArithmetic(const TVector& Target)
+    {
+        static_assert(Amount >= 0 && Amount < ElementSize<TVector>() * 8);
+
+        return ShiftRightBitsArithmetic(Target, Amount);
+    }
+
+    //Shifts every lane by the amount in the same lane of Amounts. 32 and 64 bit lanes map to vpsllvd / vpsllvq,
+    //narrower lanes are left to the compiler which widens them or uses the AVX512 word shifts when available
+    template<typename TVector>
+    ATTRAVX TVector ShiftLeftBits(const TVector& Target, const TVector& Amounts)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
+
+        if constexpr(ElementSize<TVector>() == 4)
+        {
+            if constexpr(alignof(TVector) == 32)
             {
-                return TVectorRegister{Vector * Other.Vector};
+                return Internal::MakeFromView<TVector>(__builtin_ia32_psllv8si(Internal::ViewAs<TVector, Internal::int32_8>(Target), Internal::ViewAs<TVector, Internal::int32_8>(Amounts)));
             }
-
-            ATTRAVX TVectorRegister operator/(const TVectorRegister& Other) const
+            else if constexpr(alignof(TVector) == 16)
             {
-                return TVectorRegister{Vector / Other.Vector};
+                return Internal::MakeFromView<TVector>(__builtin_ia32_psllv4si(Internal::ViewAs<TVector, Internal::int32_4>(Target), Internal::ViewAs<TVector, Internal::int32_4>(Amounts)));
             }
-
-            ATTRAVX TVectorRegister& operator+=(const TVectorRegister& Other)
+        }
+        else if constexpr(ElementSize<TVector>() == 8)
+        {
+            if constexpr(alignof(TVector) == 32)
             {
-                Vector += Other.Vector;
-                return *this;
+                return Internal::MakeFromView<TVector>(__builtin_ia32_psllv4di(Internal::ViewAs<TVector, Internal::int64_4>(Target), Internal::ViewAs<TVector, Internal::int64_4>(Amounts)));
             }
-
-            ATTRAVX TVectorRegister& operator-=(const TVectorRegister& Other)
+            else if constexpr(alignof(TVector) == 16)
             {
-                Vector -= Other.Vector;
+                return Internal::MakeFromView<TVector>(__builtin_ia32_psllv2di(Internal::ViewAs<TVector, Internal::int64_2>(Target), Internal::ViewAs<TVector, Internal::int64_2>(Amounts)));
+            }
+        }
+        else
+        {
+            return TVector{Target.Vector << Amounts.Vector};
+        }
+    }
+
+    //Arithmetic for signed lanes and logical for unsigned lanes, maps to vpsrlvd / vpsrlvq / vpsravd where they exist
+    template<typename TVector>
+    ATTRAVX TVector ShiftRightBits(const TVector& Target, const TVector& Amounts)
+    {
+        using ElementType = typename TVector::ElementType;
+
+        static_assert(std::is_integral_v<ElementType>);
+
+        if constexpr(ElementSize<TVector>() == 4)
+        {
+            if constexpr(alignof(TVector) == 32)
+            {
+                if constexpr(std::is_signed_v<ElementType>)
+                {
+                    return Internal::MakeFromView<TVector>(__builtin_ia32_psrav8si(Internal::ViewAs<TVector, Internal::int32_8>(Target), Internal::ViewAs<TVector, Internal::int32_8>(Amounts)));
+                }
+                else if constexpr(!std::is_signed_v<ElementType>)
+                {
+                    return Internal::MakeFromView<TVector>(__builtin_ia32_psrlv8si(Internal::ViewAs<TVector, Internal::int32_8>(Target), Internal::ViewAs<TVector, Internal::int32_8>(Amounts)));
+                }
+            }
+            else if constexpr(alignof(TVector) == 16)
+            {
+                if constexpr(std::is_signed_v<ElementType>)
+                {
+                    return Internal::MakeFromView<TVector>(__builtin_ia32_psrav4si(Internal::ViewAs<TVector, Internal::int32_4>(Target), Internal::ViewAs<TVector, Internal::int32_4>(Amounts)));
+                }
+                else if constexpr(!std::is_signed_v<ElementType>)
+                {
+                    return Internal::MakeFromView<TVector>(__builtin_ia32_psrlv4si(Internal::ViewAs<TVector, Internal::int32_4>(Target), Internal::ViewAs<TVector, Internal::int32_4>(Amounts)));
+                }
+            }
+        }
+        else if constexpr(ElementSize<TVector>() == 8 && !std::is_signed_v<ElementType>)
+        {
+            if constexpr(alignof(TVector) == 32)
+            {
+                return Internal::MakeFromView<TVector>(__builtin_ia32_psrlv4di(Internal::ViewAs<TVector, Internal::int64_4>(Target), Internal::ViewAs<TVector, Internal::int64_4>(Amounts)));
+            }
+            else if constexpr(alignof(TVector) == 16)
+            {
+                return Internal::MakeFromView<TVector>(__builtin_ia32_psrlv2di(Internal::ViewAs<TVector, Internal::int64_2>(Target), Internal::ViewAs<TVector, Internal::int64_2>(Amounts)));
+            }
+        }
+        else
+        {
+            return TVector{Target.Vector >> Amounts.Vector};
+        }
+    }
+
+    //Rotates the bits inside every lane towards the most significant bit, uses vprold / vprolq with AVX512 and two shifts otherwise
+    template<typename TVector>
+    ATTRAVX TVector RotateLeftBits(const TVector& Target, const int32 Amount)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
+
+        constexpr int32 LaneBits{ElementSize<TVector>() * 8};
+
+#ifdef AVX512
+        if constexpr(ElementSize<TVector>() == 4 && alignof(TVector) == 32)
+        {
+            return Internal::MakeFromView<TVector>(__builtin_ia32_prolvd256(Internal::ViewAs<TVector, Internal::int32_8>(Target), Internal::int32_8{} + Amount));
+        }
+        else if constexpr(ElementSize<TVector>() == 8 && alignof(TVector) == 32)
+        {
+            return Internal::MakeFromView<TVector>(__builtin_ia32_prolvq256(Internal::ViewAs<TVector, Internal::int64_4>(Target), Internal::int64_4{} + Amount));
+        }
+#endif
+        //a shift by the full lane width clears the lane, so an amount of 0 works without a special case
+        return TVector{Internal::LogicalShiftLeft(Target, Amount).Vector | Internal::LogicalShiftRight(Target, LaneBits - Amount).Vector};
+    }
+
+    template<int32 Amount, typename TVector>
+    ATTRAVX TVector RotateLeftBits(const TVector& Target)
+    {
+        static_assert(Amount >= 0 && Amount < ElementSize<TVector>() * 8);
+
+#ifdef AVX512
+        if constexpr(ElementSize<TVector>() == 4 && alignof(TVector) == 32)
+        {
+            return Internal::MakeFromView<TVector>(__builtin_ia32_prold256(Internal::ViewAs<TVector, Internal::int32_8>(Target), Amount));
+        }
+        else if constexpr(ElementSize<TVector>() == 8 && alignof(TVector) == 32)
+        {
+            return Internal::MakeFromView<TVector>(__builtin_ia32_prolq256(Internal::ViewAs<TVector, Internal::int64_4>(Target), Amount));
+        }
+#endif
+        return RotateLeftBits(Target, Amount);
+    }
+
+    template<typename TVector>
+    ATTRAVX TVector RotateRightBits(const TVector& Target, const int32 Amount)
+    {
+        constexpr int32 LaneBits{ElementSize<TVector>() * 8};
+
+        return RotateLeftBits(Target, (LaneBits - Amount) & (LaneBits - 1));
+    }
+
+    template<int32 Amount, typename TVector>
+    ATTRAVX TVector RotateRightBits(const TVector& Target)
+    {
+        constexpr int32 LaneBits{ElementSize<TVector>() * 8};
+
+        static_assert(Amount >= 0 && Amount < LaneBits);
+
+        return RotateLeftBits<(LaneBits - Amount) & (LaneBits - 1)>(Target);
+    }
+
+    namespace Internal
+    {
+        template<typename T, uint64 NumLanes>
+        using TRawVector = T __attribute__((__vector_size__(sizeof(T) * NumLanes), __aligned__(sizeof(T) * NumLanes)));
+
+        template<uint64 FirstLane, typename TRaw, uint64... Lanes>
+        ATTRAVX auto ExtractLanes(const TRaw& Source, std::integer_sequence<uint64, Lanes...>)
+        {
+            return __builtin_shufflevector(Source, Source, (FirstLane + Lanes)...);
+        }
+
+        template<typename TRaw, uint64... Lanes>
+        ATTRAVX auto ConcatenateLanes(const TRaw& Low, const TRaw& High, std::integer_sequence<uint64, Lanes...>)
+        {
+            return __builtin_shufflevector(Low, High, Lanes...);
+        }
+
+        //the 256 bit packs work per 128 bit half, this puts the 64 bit blocks of (Low0, High0, Low1, High1) back in order
+        template<typename TRaw>
+        ATTRAVX TRaw FixPackOrder(const TRaw& Packed)
+        {
+            return reinterpret_cast<TRaw>(__builtin_shufflevector(reinterpret_cast<int64_4>(Packed), reinterpret_cast<int64_4>(Packed), 0, 2, 1, 3));
+        }
+
+        template<typename T>
+        inline constexpr bool bIsHalfFloat{std::is_same_v<T, float16> || std::is_same_v<T, bfloat16>};
+
+        //vcvtph2ps for float16 is exact, bfloat16 only needs its bits moved into the upper half of a float32
+        template<typename THalf>
+        ATTRAVX float32_8 WidenHalfFloat(const TRawVector<THalf, 8>& Source)
+        {
+            if constexpr(std::is_same_v<THalf, float16>)
+            {
+                return __builtin_ia32_vcvtph2ps256(reinterpret_cast<int16_8>(Source));
+            }
+            else if constexpr(std::is_same_v<THalf, bfloat16>)
+            {
+                return reinterpret_cast<float32_8>(__builtin_convertvector(reinterpret_cast<uint16_8>(Source), uint32_8) << 16);
+            }
+        }
+
+        //Rounds to nearest even. vcvtps2ph for float16, for bfloat16 adding 0x7FFF plus the lowest kept bit before dropping the lower
+        //half rounds the same way, NaNs are kept quiet so the rounding can't carry them into infinity
+        template<typename THalf>
+        ATTRAVX TRawVector<THalf, 8> NarrowHalfFloat(const float32_8& Source)
+        {
+            if constexpr(std::is_same_v<THalf, float16>)
+            {
+                return reinterpret_cast<TRawVector<THalf, 8>>(__builtin_ia32_vcvtps2ph256(Source, 0));
+            }
+            else if constexpr(std::is_same_v<THalf, bfloat16>)
+            {
+                const uint32_8 Bits{reinterpret_cast<uint32_8>(Source)};
+                const uint32_8 Rounded{Bits + 0x7FFF + ((Bits >> 16) & 1)};
+                const uint32_8 IsNaN{reinterpret_cast<uint32_8>(Source != Source)};
+
+                return reinterpret_cast<TRawVector<THalf, 8>>(__builtin_convertvector(((Rounded & ~IsNaN) | ((Bits | 0x400000) & IsNaN)) >> 16, uint16_8));
+            }
+        }
+
+        template<uint64 NumLanes, typename TRaw>
+        ATTRAVX auto ReduceAddLanes(const TRaw& Source)
+        {
+            if constexpr(NumLanes == 1)
+            {
+                return Source[0];
+            }
+            else
+            {
+                return ReduceAddLanes<NumLanes / 2>(ExtractLanes<0>(Source, std::make_integer_sequence<uint64, NumLanes / 2>{})
+                    + ExtractLanes<NumLanes / 2>(Source, std::make_integer_sequence<uint64, NumLanes / 2>{}));
+            }
+        }
+    }
+
+    //Sum of all lanes, the upper half is added onto the lower half until one lane is left. The order is fixed,
+    //so float sums come out the same on every call
+    template<typename TVector>
+    ATTRAVX typename TVector::ElementType ReduceAdd(const TVector& Source)
+    {
+        return Internal::ReduceAddLanes<TVector::NumElements>(Source.Vector);
+    }
+
+    //Same bits seen as another register type of the same size
+    template<typename TTo, typename TFrom>
+    ATTRAVX TTo Reinterpret(const TFrom& Source)
+    {
+        static_assert(sizeof(TTo) == sizeof(TFrom));
+
+        return TTo{reinterpret_cast<typename TTo::VectorType>(Source.Vector)};
+    }
+
+    //Converts the value of every lane, both types need the same number of lanes. Integers widen with pmovzx / pmovsx,
+    //float and double convert to each other, and floats converted to integers truncate towards zero
+    template<typename TTo, typename TFrom>
+    ATTRAVX TTo Convert(const TFrom& Source)
+    {
+        static_assert(TTo::NumElements == TFrom::NumElements);
+
+        return TTo{__builtin_convertvector(Source.Vector, typename TTo::VectorType)};
+    }
+
+    //Converts the lower half of the lanes into a register with twice as wide lanes, like uint8_32 to uint16_16.
+    //float16_16 and bfloat16_16 widen to float32_8 exactly
+    template<typename TTo, typename TFrom>
+    ATTRAVX TTo WidenLow(const TFrom& Source)
+    {
+        static_assert(TTo::NumElements * 2 == TFrom::NumElements);
+
+        if constexpr(Internal::bIsHalfFloat<typename TFrom::ElementType>)
+        {
+            static_assert(std::is_same_v<TTo, float32_8>);
+
+            return TTo{Internal::WidenHalfFloat(Internal::ExtractLanes<0>(Source.Vector, std::make_integer_sequence<uint64, TTo::NumElements>{}))};
+        }
+        else
+        {
+            return TTo{__builtin_convertvector(Internal::ExtractLanes<0>(Source.Vector, std::make_integer_sequence<uint64, TTo::NumElements>{}), typename TTo::VectorType)};
+        }
+    }
+
+    template<typename TTo, typename TFrom>
+    ATTRAVX TTo WidenHigh(const TFrom& Source)
+    {
+        static_assert(TTo::NumElements * 2 == TFrom::NumElements);
+
+        if constexpr(Internal::bIsHalfFloat<typename TFrom::ElementType>)
+        {
+            static_assert(std::is_same_v<TTo, float32_8>);
+
+            return TTo{Internal::WidenHalfFloat(Internal::ExtractLanes<TTo::NumElements>(Source.Vector, std::make_integer_sequence<uint64, TTo::NumElements>{}))};
+        }
+        else
+        {
+            return TTo{__builtin_convertvector(Internal::ExtractLanes<TTo::NumElements>(Source.Vector, std::make_integer_sequence<uint64, TTo::NumElements>{}), typename TTo::VectorType)};
+        }
+    }
+
+    //Converts two registers into one with half as wide lanes, Low fills the lower half. Integers are truncated, doubles are rounded to float
+    //and float32_8 rounds to nearest even into float16_16 or bfloat16_16
+    template<typename TTo, typename TFrom>
+    ATTRAVX TTo Narrow(const TFrom& Low, const TFrom& High)
+    {
+        static_assert(TTo::NumElements == TFrom::NumElements * 2);
+
+        using HalfType = Internal::TRawVector<typename TTo::ElementType, TFrom::NumElements>;
+
+        if constexpr(Internal::bIsHalfFloat<typename TTo::ElementType>)
+        {
+            static_assert(std::is_same_v<TFrom, float32_8>);
+
+            return TTo{Internal::ConcatenateLanes(Internal::NarrowHalfFloat<typename TTo::ElementType>(Low.Vector), Internal::NarrowHalfFloat<typename TTo::ElementType>(High.Vector),
+                std::make_integer_sequence<uint64, TTo::NumElements>{})};
+        }
+        else
+        {
+            return TTo{Internal::ConcatenateLanes(__builtin_convertvector(Low.Vector, HalfType), __builtin_convertvector(High.Vector, HalfType), std::make_integer_sequence<uint64, TTo::NumElements>{})};
+        }
+    }
+
+    //Integer Narrow that clamps every lane to the range of the narrower type. The 16 and 32 bit signed sources map to packss / packus,
+    //everything else clamps with min / max first
+    template<typename TTo, typename TFrom>
+    ATTRAVX TTo NarrowSaturate(const TFrom& Low, const TFrom& High)
+    {
+        using FromType = typename TFrom::ElementType;
+        using ToType = typename TTo::ElementType;
+        using VectorType = typename TTo::VectorType;
+
+        static_assert(std::is_integral_v<FromType> && std::is_integral_v<ToType>);
+        static_assert(TTo::NumElements == TFrom::NumElements * 2);
+
+        if constexpr(std::is_signed_v<FromType> && ElementSize<TFrom>() == 2 && alignof(TFrom) == 32)
+        {
+            if constexpr(std::is_signed_v<ToType>)
+            {
+                return TTo{reinterpret_cast<VectorType>(Internal::FixPackOrder(__builtin_ia32_packsswb256(Low.Vector, High.Vector)))};
+            }
+            else if constexpr(!std::is_signed_v<ToType>)
+            {
+                return TTo{reinterpret_cast<VectorType>(Internal::FixPackOrder(__builtin_ia32_packuswb256(Low.Vector, High.Vector)))};
+            }
+        }
+        else if constexpr(std::is_signed_v<FromType> && ElementSize<TFrom>() == 4 && alignof(TFrom) == 32)
+        {
+            if constexpr(std::is_signed_v<ToType>)
+            {
+                return TTo{reinterpret_cast<VectorType>(Internal::FixPackOrder(__builtin_ia32_packssdw256(Low.Vector, High.Vector)))};
+            }
+            else if constexpr(!std::is_signed_v<ToType>)
+            {
+                return TTo{reinterpret_cast<VectorType>(Internal::FixPackOrder(__builtin_ia32_packusdw256(Low.Vector, High.Vector)))};
+            }
+        }
+        else if constexpr(std::is_signed_v<FromType> && ElementSize<TFrom>() == 2 && alignof(TFrom) == 16)
+        {
+            if constexpr(std::is_signed_v<ToType>)
+            {
+                return TTo{reinterpret_cast<VectorType>(__builtin_ia32_packsswb128(Low.Vector, High.Vector))};
+            }
+            else if constexpr(!std::is_signed_v<ToType>)
+            {
+                return TTo{reinterpret_cast<VectorType>(__builtin_ia32_packuswb128(Low.Vector, High.Vector))};
+            }
+        }
+        else if constexpr(std::is_signed_v<FromType> && ElementSize<TFrom>() == 4 && alignof(TFrom) == 16)
+        {
+            if constexpr(std::is_signed_v<ToType>)
+            {
+                return TTo{reinterpret_cast<VectorType>(__builtin_ia32_packssdw128(Low.Vector, High.Vector))};
+            }
+            else if constexpr(!std::is_signed_v<ToType>)
+            {
+                return TTo{reinterpret_cast<VectorType>(__builtin_ia32_packusdw128(Low.Vector, High.Vector))};
+            }
+        }
+        else
+        {
+            //only a signed source into a signed target keeps negative lanes
+            constexpr FromType Lowest{std::is_signed_v<FromType> && std::is_signed_v<ToType> ? static_cast<FromType>(std::numeric_limits<ToType>::min()) : FromType{0}};
+            constexpr FromType Highest{static_cast<FromType>(std::numeric_limits<ToType>::max())};
+
+            const TFrom ClampedLow{__builtin_elementwise_min(__builtin_elementwise_max(Low.Vector, TFrom{Lowest}.Vector), TFrom{Highest}.Vector)};
+            const TFrom ClampedHigh{__builtin_elementwise_min(__builtin_elementwise_max(High.Vector, TFrom{Lowest}.Vector), TFrom{Highest}.Vector)};
+
+            return Narrow<TTo>(ClampedLow, ClampedHigh);
+        }
+    }
+
+    namespace Internal
+    {
+        //the registers as one raw vector of a power of two registers, with three the last one is repeated to fill the fourth
+        template<uint64 NumRegisters, typename TVector>
+        ATTRAVX auto ConcatenateRegisters(const TVector (&Source)[NumRegisters])
+        {
+            constexpr uint64 NumLanes{TVector::NumElements};
+
+            const auto Pair0{ConcatenateLanes(Source[0].Vector, Source[1].Vector, std::make_integer_sequence<uint64, NumLanes * 2>{})};
+
+            if constexpr(NumRegisters == 2)
+            {
+                return Pair0;
+            }
+            else
+            {
+                const auto Pair1{ConcatenateLanes(Source[2].Vector, Source[NumRegisters - 1].Vector, std::make_integer_sequence<uint64, NumLanes * 2>{})};
+                return ConcatenateLanes(Pair0, Pair1, std::make_integer_sequence<uint64, NumLanes * 4>{});
+            }
+        }
+
+        //every NumFields-th lane of the concatenated structs starting at Field
+        template<uint64 NumFields, uint64 Field, typename TRaw, uint64... Lanes>
+        ATTRAVX auto GatherField(const TRaw& Structs, std::integer_sequence<uint64, Lanes...>)
+        {
+            return __builtin_shufflevector(Structs, Structs, (Field + NumFields * Lanes)...);
+        }
+
+        //register Index of the structs written out, lane L of it is struct L / NumFields of field L % NumFields
+        template<uint64 NumFields, uint64 Index, typename TRaw, uint64... Lanes>
+        ATTRAVX auto ScatterFields(const TRaw& Fields, std::integer_sequence<uint64, Lanes...>)
+        {
+            constexpr uint64 NumLanes{sizeof...(Lanes)};
+
+            return __builtin_shufflevector(Fields, Fields, ((Index * NumLanes + Lanes) % NumFields * NumLanes + (Index * NumLanes + Lanes) / NumFields)...);
+        }
+
+        template<uint64 NumFields, typename TVector, uint64... Field>
+        ATTRAVX void DeinterleaveFields(const TVector (&Source)[NumFields], TVector (&Fields)[NumFields], std::integer_sequence<uint64, Field...>)
+        {
+            const auto Structs{ConcatenateRegisters(Source)};
+
+            ((Fields[Field] = TVector{GatherField<NumFields, Field>(Structs, std::make_integer_sequence<uint64, TVector::NumElements>{})}), ...);
+        }
+
+        template<uint64 NumFields, typename TVector, uint64... Index>
+        ATTRAVX void InterleaveFields(const TVector (&Fields)[NumFields], TVector (&Out)[NumFields], std::integer_sequence<uint64, Index...>)
+        {
+            const auto Concatenated{ConcatenateRegisters(Fields)};
+
+            ((Out[Index] = TVector{ScatterFields<NumFields, Index>(Concatenated, std::make_integer_sequence<uint64, TVector::NumElements>{})}), ...);
+        }
+    }
+
+    //Transposes the 4x4 matrix held one row per register in place, 32 bit lanes. With 8 lanes the two 128 bit halves are
+    //transposed as separate matrices, which moves 8 rows of 4 values to 4 registers of 8 and back
+    template<typename TVector>
+    ATTRAVX void Transpose4x4(TVector (&Rows)[4])
+    {
+        static_assert(ElementSize<TVector>() == 4);
+
+        if constexpr(TVector::NumElements == 4)
+        {
+            const TVector Low01{ShuffleVector<TVector, 0, 4, 1, 5>(Rows[0], Rows[1])};
+            const TVector High01{ShuffleVector<TVector, 2, 6, 3, 7>(Rows[0], Rows[1])};
+            const TVector Low23{ShuffleVector<TVector, 0, 4, 1, 5>(Rows[2], Rows[3])};
+            const TVector High23{ShuffleVector<TVector, 2, 6, 3, 7>(Rows[2], Rows[3])};
+
+            Rows[0] = TVector{ShuffleVector<TVector, 0, 1, 4, 5>(Low01, Low23)};
+            Rows[1] = TVector{ShuffleVector<TVector, 2, 3, 6, 7>(Low01, Low23)};
+            Rows[2] = TVector{ShuffleVector<TVector, 0, 1, 4, 5>(High01, High23)};
+            Rows[3] = TVector{ShuffleVector<TVector, 2, 3, 6, 7>(High01, High23)};
+        }
+        else if constexpr(TVector::NumElements == 8)
+        {
+            const TVector Low01{ShuffleVector<TVector, 0, 8, 1, 9, 4, 12, 5, 13>(Rows[0], Rows[1])};
+            const TVector High01{ShuffleVector<TVector, 2, 10, 3, 11, 6, 14, 7, 15>(Rows[0], Rows[1])};
+            const TVector Low23{ShuffleVector<TVector, 0, 8, 1, 9, 4, 12, 5, 13>(Rows[2], Rows[3])};
+            const TVector High23{ShuffleVector<TVector, 2, 10, 3, 11, 6, 14, 7, 15>(Rows[2], Rows[3])};
+
+            Rows[0] = TVector{ShuffleVector<TVector, 0, 1, 8, 9, 4, 5, 12, 13>(Low01, Low23)};
+            Rows[1] = TVector{ShuffleVector<TVector, 2, 3, 10, 11, 6, 7, 14, 15>(Low01, Low23)};
+            Rows[2] = TVector{ShuffleVector<TVector, 0, 1, 8, 9, 4, 5, 12, 13>(High01, High23)};
+            Rows[3] = TVector{ShuffleVector<TVector, 2, 3, 10, 11, 6, 7, 14, 15>(High01, High23)};
+        }
+    }
+
+    //Transposes the 8x8 matrix held one row per register in place, 32 bit lanes. Unpacks pair up rows, 64 bit shuffles build
+    //4x4 blocks within each 128 bit half and vperm2f128 swaps the off diagonal halves, 24 shuffles in total
+    template<typename TVector>
+    ATTRAVX void Transpose8x8(TVector (&Rows)[8])
+    {
+        static_assert(ElementSize<TVector>() == 4 && TVector::NumElements == 8);
+
+        TVector Pairs[8];
+        for(uint64 Row{0}; Row < 8; Row += 2)
+        {
+            Pairs[Row] = TVector{ShuffleVector<TVector, 0, 8, 1, 9, 4, 12, 5, 13>(Rows[Row], Rows[Row + 1])};
+            Pairs[Row + 1] = TVector{ShuffleVector<TVector, 2, 10, 3, 11, 6, 14, 7, 15>(Rows[Row], Rows[Row + 1])};
+        }
+
+        //Blocks[Column] holds rows 0 to 3 of Column and Column + 4 for the first four, rows 4 to 7 of them for the last four
+        TVector Blocks[8];
+        for(uint64 Half{0}; Half < 8; Half += 4)
+        {
+            Blocks[Half] = TVector{ShuffleVector<TVector, 0, 1, 8, 9, 4, 5, 12, 13>(Pairs[Half], Pairs[Half + 2])};
+            Blocks[Half + 1] = TVector{ShuffleVector<TVector, 2, 3, 10, 11, 6, 7, 14, 15>(Pairs[Half], Pairs[Half + 2])};
+            Blocks[Half + 2] = TVector{ShuffleVector<TVector, 0, 1, 8, 9, 4, 5, 12, 13>(Pairs[Half + 1], Pairs[Half + 3])};
+            Blocks[Half + 3] = TVector{ShuffleVector<TVector, 2, 3, 10, 11, 6, 7, 14, 15>(Pairs[Half + 1], Pairs[Half + 3])};
+        }
+
+        for(uint64 Column{0}; Column < 4; ++Column)
+        {
+            Rows[Column] = TVector{ShuffleVector<TVector, 0, 1, 2, 3, 8, 9, 10, 11>(Blocks[Column], Blocks[Column + 4])};
+            Rows[Column + 4] = TVector{ShuffleVector<TVector, 4, 5, 6, 7, 12, 13, 14, 15>(Blocks[Column], Blocks[Column + 4])};
+        }
+    }
+
+    //Splits NumFields registers of consecutive structs, like xyzxyz... loaded from memory, into one register per field.
+    //2, 3 or 4 fields of 8, 16 or 32 bit lanes, the shuffles are left to the compiler which knows the strided patterns
+    template<uint64 NumFields, typename TVector>
+    ATTRAVX void Deinterleave(const TVector (&Source)[NumFields], TVector (&Fields)[NumFields])
+    {
+        static_assert(NumFields >= 2 && NumFields <= 4);
+
+        Internal::DeinterleaveFields(Source, Fields, std::make_integer_sequence<uint64, NumFields>{});
+    }
+
+    //The inverse of Deinterleave, one register per field into NumFields registers of consecutive structs
+    template<uint64 NumFields, typename TVector>
+    ATTRAVX void Interleave(const TVector (&Fields)[NumFields], TVector (&Out)[NumFields])
+    {
+        static_assert(NumFields >= 2 && NumFields <= 4);
+
+        Internal::InterleaveFields(Fields, Out, std::make_integer_sequence<uint64, NumFields>{});
+    }
+
+    namespace Internal
+    {
+
+        //Full width result of a lane comparison, every lane is either all ones or all zeroes so it can feed a blend directly
+        template<typename TVector>
+        class alignas(typename TVector::VectorType) TVectorMask final
+        {
+        public:
+
+            using VectorType = decltype(typename TVector::VectorType{} == typename TVector::VectorType{});
+
+            //pmovmskb produces one bit per byte, so 16 bit lanes are represented by two bits each
+            inline static constexpr int32 BitsPerLane{ElementSize<TVector>() <= 2 ? static_cast<int32>(ElementSize<TVector>()) : 1};
+
+        public:
+
+            ATTRAVX explicit constexpr TVectorMask(const VectorType& Other)
+                : Vector(Other)
+            {
+            }
+
+            //The movemask form, with BitsPerLane bits for every lane
+            ATTRAVX explicit operator int32() const
+            {
+                if constexpr(alignof(TVector) == 32)
+                {
+                    if constexpr(ElementSize<TVector>() <= 2)
+                    {
+                        return __builtin_ia32_pmovmskb256(reinterpret_cast<char8_32>(Vector));
+                    }
+                    else if constexpr(ElementSize<TVector>() == 4)
+                    {
+                        return __builtin_ia32_movmskps256(reinterpret_cast<float32_8>(Vector));
+                    }
+                    else if constexpr(ElementSize<TVector>() == 8)
+                    {
+                        return __builtin_ia32_movmskpd256(reinterpret_cast<float64_4>(Vector));
+                    }
+                }
+                else if constexpr(alignof(TVector) == 16)
+                {
+                    if constexpr(ElementSize<TVector>() <= 2)
+                    {
+                        return __builtin_ia32_pmovmskb128(reinterpret_cast<char8_16>(Vector));
+                    }
+                    else if constexpr(ElementSize<TVector>() == 4)
+                    {
+                        return __builtin_ia32_movmskps(reinterpret_cast<float32_4>(Vector));
+                    }
+                    else if constexpr(ElementSize<TVector>() == 8)
+                    {
+                        return __builtin_ia32_movmskpd(reinterpret_cast<float64_2>(Vector));
+                    }
+                }
+            }
+
+            ATTRAVX bool Any() const
+            {
+                return !None();
+            }
+
+            ATTRAVX bool None() const
+            {
+                if constexpr(alignof(TVector) == 32)
+                {
+                    return __builtin_ia32_ptestz256(reinterpret_cast<int64_4>(Vector), reinterpret_cast<int64_4>(Vector));
+                }
+                else if constexpr(alignof(TVector) == 16)
+                {
+                    return __builtin_ia32_ptestz128(reinterpret_cast<int64_2>(Vector), reinterpret_cast<int64_2>(Vector));
+                }
+            }
+
+            //16 bit lanes set two movemask bits each, so 8 lanes in a 16 byte register need 16 set bits and not 8
+            ATTRAVX bool All() const
+            {
+                return static_cast<uint32>(static_cast<int32>(*this)) == static_cast<uint32>((1ull << (TVector::NumElements * BitsPerLane)) - 1);
+            }
+
+            //Index of the first set lane, or NumElements when no lane is set
+            ATTRAVX uint32 FirstSet() const
+            {
+                const uint64 Bits{static_cast<uint32>(static_cast<int32>(*this)) | (1ull << (TVector::NumElements * BitsPerLane))};
+                return __builtin_ctzll(Bits) / BitsPerLane;
+            }
+
+            ATTRAVX uint32 Count() const
+            {
+                return __builtin_popcount(static_cast<uint32>(static_cast<int32>(*this))) / BitsPerLane;
+            }
+
+            ATTRAVX TVectorMask operator&(const TVectorMask& Other) const
+            {
+                return TVectorMask{Vector & Other.Vector};
+            }
+
+            ATTRAVX TVectorMask operator|(const TVectorMask& Other) const
+            {
+                return TVectorMask{Vector | Other.Vector};
+            }
+
+            ATTRAVX TVectorMask operator^(const TVectorMask& Other) const
+            {
+                return TVectorMask{Vector ^ Other.Vector};
+            }
+
+            ATTRAVX TVectorMask operator~() const
+            {
+                return TVectorMask{~Vector};
+            }
+
+            ATTRAVX TVectorMask& operator&=(const TVectorMask& Other)
+            {
+                Vector &= Other.Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorMask& operator|=(const TVectorMask& Other)
+            {
+                Vector |= Other.Vector;
+                return *this;
+            }
+
+            //The mask as a register of the compared type, set lanes have every bit set
+            ATTRAVX TVector ToVector() const
+            {
+                return TVector{reinterpret_cast<typename TVector::VectorType>(Vector)};
+            }
+
+        public:
+
+            VectorType Vector;
+
+        };
+
+    }
+
+    template<typename TVector>
+    using TVectorMask = Internal::TVectorMask<TVector>;
+
+    namespace Internal
+    {
+
+        template<typename InVectorType, typename InElementType>
+        class alignas(InVectorType) TVectorRegister final
+        {
+        public:
+
+            using VectorType = InVectorType;
+            using ElementType = InElementType;
+
+            inline static const constinit uint64 NumElements = []() consteval -> uint64
+            {
+                return sizeof(VectorType) / sizeof(ElementType);
+            }();
+
+            inline static const constinit int32 ComparisonMask = []() consteval -> int32
+            {
+                if constexpr(alignof(TVectorRegister) == 32)
+                {
+                    switch(NumElements)
+                    {
+                        case 32: return (int32)0b11111111111111111111111111111111;
+                        case 16: return (int32)0b11111111111111111111111111111111;
+                        case 8:  return (int32)0b00000000000000000000000011111111;
+                        case 4:  return (int32)0b00000000000000000000000000001111;
+                        case 2:  return (int32)0b00000000000000000000000000000011;
+                        default: ASSERT(false); return 0;
+                    }
+                }
+                else if constexpr(alignof(TVectorRegister) == 16)
+                {
+                    switch(NumElements)
+                    {
+                        case 16: return (int32)0b00000000000000001111111111111111;
+                        case 8:  return (int32)0b00000000000000000000000011111111;
+                        case 4:  return (int32)0b00000000000000000000000000001111;
+                        case 2:  return (int32)0b00000000000000000000000000000011;
+                        default: ASSERT(false); return 0;
+                    }
+                }
+            }();
+
+        public:
+
+            ATTRAVX explicit constexpr TVectorRegister(ElementType Value = static_cast<ElementType>(0))
+                : Vector(Simd::SetAll<TVectorRegister>(Value).Vector)
+            {
+            }
+
+            template<typename... Elements>
+            ATTRAVX explicit constexpr TVectorRegister(Elements... ElementValues)
+                : Vector{static_cast<ElementType>(ElementValues)...}
+            {
+                static_assert(NumElements == sizeof...(ElementValues));
+            }
+
+            ATTRAVX constexpr TVectorRegister(const TVectorRegister& Other)
+                : Vector(Other.Vector)
+            {
+            }
+
+            ATTRAVX constexpr TVectorRegister(TVectorRegister&& Other) noexcept
+                : Vector(static_cast<VectorType&&>(Other.Vector))
+            {
+            }
+
+            ATTRAVX explicit constexpr TVectorRegister(const VectorType& Other)
+                : Vector(Other)
+            {
+            }
+
+            ATTRAVX explicit constexpr TVectorRegister(VectorType&& Other)
+                : Vector(static_cast<VectorType&&>(Other))
+            {
+            }
+
+            ATTRAVX ElementType* ToPtr()
+            {
+                return Memory::AssumeAligned<alignof(VectorType)>(reinterpret_cast<ElementType*>(&Vector));
+            }
+
+            ATTRAVX const ElementType* ToPtr() const
+            {
+                return Memory::AssumeAligned<alignof(VectorType)>(reinterpret_cast<const ElementType*>(&Vector));
+            }
+
+        public:
+
+            template<typename IndexType>
+            ATTRAVX ElementType& operator[](const IndexType Index)
+            {
+                return ToPtr()[Index];
+            }
+
+            template<typename IndexType>
+            ATTRAVX ElementType operator[](const IndexType Index) const
+            {
+                return Vector[Index];
+            }
+
+            ATTRAVX constexpr TVectorRegister& operator=(const VectorType& Other)
+            {
+                Vector = Other;
+                return *this;
+            }
+
+            ATTRAVX constexpr TVectorRegister& operator=(const TVectorRegister& Other)
+            {
+                Vector = Other.Vector;
+                return *this;
+            }
+
+            ATTRAVX constexpr TVectorRegister& operator=(TVectorRegister&& Other)
+            {
+                Vector = static_cast<VectorType&&>(Other.Vector);
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister operator+(const TVectorRegister& Other) const
+            {
+                return TVectorRegister{Vector + Other.Vector};
+            }
+
+            ATTRAVX TVectorRegister operator-(const TVectorRegister& Other) const
+            {
+                return TVectorRegister{Vector - Other.Vector};
+            }
+
+            ATTRAVX TVectorRegister operator*(const TVectorRegister& Other) const
+            {
+                return TVectorRegister{Vector * Other.Vector};
+            }
+
+            ATTRAVX TVectorRegister operator/(const TVectorRegister& Other) const
+            {
+                return TVectorRegister{Vector / Other.Vector};
+            }
+
+            ATTRAVX TVectorRegister& operator+=(const TVectorRegister& Other)
+            {
+                Vector += Other.Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister& operator-=(const TVectorRegister& Other)
+            {
+                Vector -= Other.Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister& operator*=(const TVectorRegister& Other)
+            {
+                Vector *= Other.Vector;
                 return *this;
             }
-
-            ATTRAVX TVectorRegister& operator*=(const TVectorRegister& Other)
+
+            ATTRAVX TVectorRegister& operator/=(const TVectorRegister& Other) const
+            {
+                Vector /= Other.Vector;
+                return *this;
+            }
+            //Use Any() / All() on the result, or convert it to int32 for the movemask
+            ATTRAVX TVectorMask<TVectorRegister> operator==(const TVectorRegister& Other) const
+            {
+                return TVectorMask<TVectorRegister>{Vector == Other.Vector};
+            }
+
+            ATTRAVX TVectorMask<TVectorRegister> operator!=(const TVectorRegister& Other) const
+            {
+                return TVectorMask<TVectorRegister>{Vector != Other.Vector};
+            }
+
+            ATTRAVX TVectorMask<TVectorRegister> operator>(const TVectorRegister& Other) const
+            {
+                return TVectorMask<TVectorRegister>{Vector > Other.Vector};
+            }
+
+            ATTRAVX TVectorMask<TVectorRegister> operator>=(const TVectorRegister& Other) const
+            {
+                return TVectorMask<TVectorRegister>{Vector >= Other.Vector};
+            }
+
+            ATTRAVX TVectorMask<TVectorRegister> operator<(const TVectorRegister& Other) const
+            {
+                return TVectorMask<TVectorRegister>{Vector < Other.Vector};
+            }
+
+            ATTRAVX TVectorMask<TVectorRegister> operator<=(const TVectorRegister& Other) const
+            {
+                return TVectorMask<TVectorRegister>{Vector <= Other.Vector};
+            }
+
+            ATTRAVX TVectorRegister operator&(const TVectorRegister& Other) const
+            {
+                return TVectorRegister{Vector & Other.Vector};
+            }
+
+            ATTRAVX TVectorRegister& operator&=(const TVectorRegister& Other)
+            {
+                Vector &= Other.Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister operator^(const TVectorRegister& Other) const
+            {
+                return TVectorRegister{Vector ^ Other.Vector};
+            }
+
+            ATTRAVX TVectorRegister& operator^=(const TVectorRegister& Other)
+            {
+                Vector ^= Other.Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister operator|(const TVectorRegister& Other) const
+            {
+                return TVectorRegister{Vector | Other.Vector};
+            }
+
+            ATTRAVX TVectorRegister& operator|=(const TVectorRegister& Other)
+            {
+                Vector |= Other.Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister& operator>>=(const int32 ShuffleAmount)
+            {
+                Vector = ShuffleRight(*this, ShuffleAmount).Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister operator>>(const int32 ShuffleAmount)
+            {
+                return TVectorRegister{ShuffleRight(*this, ShuffleAmount)};
+            }
+
+            ATTRAVX TVectorRegister& operator<<=(const int32 ShuffleAmount)
+            {
+                Vector = ShuffleLeft(*this, ShuffleAmount).Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister operator<<(const int32 ShuffleAmount) const
+            {
+                return TVectorRegister{ShuffleLeft(*this, ShuffleAmount)};
+            }
+
+            ATTRAVX TVectorRegister& operator+()
+            {
+                Vector = Simd::Absolute(*this).Vector;
+                return *this;
+            }
+
+            ATTRAVX TVectorRegister& operator-()
+            {
+                Vector = ~Simd::Absolute(*this).Vector;
+                return *this;
+            }
+
+            ATTRAVX void operator--()
+            {
+                Vector -= Simd::SetAll<TVectorRegister>(1);
+            }
+
+            ATTRAVX void operator++()
+            {
+                Vector += Simd::SetAll<TVectorRegister>(1);
+            }
+
+        public:
+
+            VectorType Vector;
+
+        };
+
+    }
+
+    //Picks IfTrue in the lanes where Mask is set and IfFalse elsewhere, compiles to a single vblendv
+    template<typename TVector>
+    ATTRAVX TVector Select(const TVectorMask<TVector>& Mask, const TVector& IfTrue, const TVector& IfFalse)
+    {
+        using VectorType = typename TVector::VectorType;
+
+        if constexpr(alignof(TVector) == 32)
+        {
+            if constexpr(ElementSize<TVector>() <= 2)
+            {
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pblendvb256(reinterpret_cast<Internal::char8_32>(IfFalse.Vector), reinterpret_cast<Internal::char8_32>(IfTrue.Vector), reinterpret_cast<Internal::char8_32>(Mask.Vector)))};
+            }
+            else if constexpr(ElementSize<TVector>() == 4)
+            {
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_blendvps256(reinterpret_cast<Internal::float32_8>(IfFalse.Vector), reinterpret_cast<Internal::float32_8>(IfTrue.Vector), reinterpret_cast<Internal::float32_8>(Mask.Vector)))};
+            }
+            else if constexpr(ElementSize<TVector>() == 8)
+            {
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_blendvpd256(reinterpret_cast<Internal::float64_4>(IfFalse.Vector), reinterpret_cast<Internal::float64_4>(IfTrue.Vector), reinterpret_cast<Internal::float64_4>(Mask.Vector)))};
+            }
+        }
+        else if constexpr(alignof(TVector) == 16)
+        {
+            if constexpr(ElementSize<TVector>() <= 2)
+            {
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pblendvb128(reinterpret_cast<Internal::char8_16>(IfFalse.Vector), reinterpret_cast<Internal::char8_16>(IfTrue.Vector), reinterpret_cast<Internal::char8_16>(Mask.Vector)))};
+            }
+            else if constexpr(ElementSize<TVector>() == 4)
             {
-                Vector *= Other.Vector;
-                return *this;
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_blendvps(reinterpret_cast<Internal::float32_4>(IfFalse.Vector), reinterpret_cast<Internal::float32_4>(IfTrue.Vector), reinterpret_cast<Internal::float32_4>(Mask.Vector)))};
             }
-
-            ATTRAVX TVectorRegister& operator/=(const TVectorRegister& Other) const
+            else if constexpr(ElementSize<TVector>() == 8)
             {
-                Vector /= Other.Vector;
-                return *this;
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_blendvpd(reinterpret_cast<Internal::float64_2>(IfFalse.Vector), reinterpret_cast<Internal::float64_2>(IfTrue.Vector), reinterpret_cast<Internal::float64_2>(Mask.Vector)))};
             }
-            //To see if ANY element does match, compare the result of this function against != 0
-            //To see if ALL elements do match, compare the result of this function against == ComparisonMask
-            ATTRAVX int32 operator==(const TVectorRegister& Other) const
+        }
+    }
+
+    //The masked operations apply the operation in the lanes where Mask is set and pass Target through elsewhere
+
+    template<typename TVector>
+    ATTRAVX TVector MaskedAdd(const TVectorMask<TVector>& Mask, const TVector& Target, const TVector& Other)
+    {
+        return Select(Mask, Target + Other, Target);
+    }
+
+    template<typename TVector>
+    ATTRAVX TVector MaskedSubtract(const TVectorMask<TVector>& Mask, const TVector& Target, const TVector& Other)
+    {
+        return Select(Mask, Target - Other, Target);
+    }
+
+    template<typename TVector>
+    ATTRAVX TVector MaskedMultiply(const TVectorMask<TVector>& Mask, const TVector& Target, const TVector& Other)
+    {
+        return Select(Mask, Target * Other, Target);
+    }
+
+    template<typename TVector>
+    ATTRAVX TVector MaskedDivide(const TVectorMask<TVector>& Mask, const TVector& Target, const TVector& Other)
+    {
+        //integer division traps on zero, so the masked off lanes divide by one instead of by whatever Other holds there
+        return Select(Mask, Target / Select(Mask, Other, TVector{static_cast<typename TVector::ElementType>(1)}), Target);
+    }
+
+    //Adds and clamps to the range of the lane type instead of wrapping, paddsb / paddusb / paddsw / paddusw for 8 and 16 bit lanes
+    template<typename TVector>
+    ATTRAVX TVector AddSaturate(const TVector& LHS, const TVector& RHS)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
+
+        return TVector{__builtin_elementwise_add_sat(LHS.Vector, RHS.Vector)};
+    }
+
+    //Subtracts and clamps to the range of the lane type instead of wrapping, psubsb / psubusb / psubsw / psubusw for 8 and 16 bit lanes
+    template<typename TVector>
+    ATTRAVX TVector SubtractSaturate(const TVector& LHS, const TVector& RHS)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
+
+        return TVector{__builtin_elementwise_sub_sat(LHS.Vector, RHS.Vector)};
+    }
+
+    //(LHS + RHS + 1) >> 1 without overflow, only for unsigned 8 and 16 bit lanes
+    template<typename TVector>
+    ATTRAVX TVector Average(const TVector& LHS, const TVector& RHS)
+    {
+        static_assert(!std::is_signed_v<typename TVector::ElementType> && ElementSize<TVector>() <= 2);
+
+        using VectorType = typename TVector::VectorType;
+
+        if constexpr(alignof(TVector) == 32)
+        {
+            if constexpr(ElementSize<TVector>() == 1)
             {
-                return CompareEqual(*this, Other);
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pavgb256(LHS.Vector, RHS.Vector))};
             }
-            //To see if ANY element does not match, compare the result of this function against != 0
-            //To see if ALL elements do not match, compare the result of this function against == ComparisonMask
-            ATTRAVX int32 operator!=(const TVectorRegister& Other) const
+            else if constexpr(ElementSize<TVector>() == 2)
             {
-                return CompareNotEqual(*this, Other);
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pavgw256(LHS.Vector, RHS.Vector))};
             }
-            //To see if ANY element does match, compare the result of this function against != 0
-            //To see if ALL elements do match, compare the result of this function against == ComparisonMask
-            ATTRAVX int32 operator>(const TVectorRegister& Other) const
+        }
+        else if constexpr(alignof(TVector) == 16)
+        {
+            if constexpr(ElementSize<TVector>() == 1)
             {
-                return CompareGreater(*this, Other);
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pavgb128(LHS.Vector, RHS.Vector))};
             }
-            //To see if ANY element does match, compare the result of this function against != 0
-            //To see if ALL elements do match, compare the result of this function against == ComparisonMask
-            ATTRAVX int32 operator>=(const TVectorRegister& Other) const
+            else if constexpr(ElementSize<TVector>() == 2)
             {
-                return CompareGreaterOrEqual(*this, Other);
+                return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pavgw128(LHS.Vector, RHS.Vector))};
             }
-            //To see if ANY element does match, compare the result of this function against != 0
-            //To see if ALL elements do match, compare the result of this function against == ComparisonMask
-            ATTRAVX int32 operator<(const TVectorRegister& Other) const
+        }
+    }
+
+    namespace Internal
+    {
+        //pmuludq / pmuldq, the full 64 bit products of the low 32 bits of every 64 bit lane
+        template<bool bSigned, typename TRaw>
+        ATTRAVX auto MultiplyEvenLanes(const TRaw& LHS, const TRaw& RHS)
+        {
+            if constexpr(sizeof(TRaw) == 32)
             {
-                return CompareLesser(*this, Other);
+                if constexpr(bSigned)
+                {
+                    return reinterpret_cast<uint64_4>(__builtin_ia32_pmuldq256(reinterpret_cast<int32_8>(LHS), reinterpret_cast<int32_8>(RHS)));
+                }
+                else if constexpr(!bSigned)
+                {
+                    return reinterpret_cast<uint64_4>(__builtin_ia32_pmuludq256(reinterpret_cast<int32_8>(LHS), reinterpret_cast<int32_8>(RHS)));
+                }
             }
-            //To see if ANY element does match, compare the result of this function against != 0
-            //To see if ALL elements do match, compare the result of this function against == ComparisonMask
-            ATTRAVX int32 operator<=(const TVectorRegister& Other) const
+            else if constexpr(sizeof(TRaw) == 16)
             {
-                return CompareLesserOrEqual(*this, Other);
+                if constexpr(bSigned)
+                {
+                    return reinterpret_cast<uint64_2>(__builtin_ia32_pmuldq128(reinterpret_cast<int32_4>(LHS), reinterpret_cast<int32_4>(RHS)));
+                }
+                else if constexpr(!bSigned)
+                {
+                    return reinterpret_cast<uint64_2>(__builtin_ia32_pmuludq128(reinterpret_cast<int32_4>(LHS), reinterpret_cast<int32_4>(RHS)));
+                }
             }
+        }
+    }
 
-            ATTRAVX TVectorRegister operator&(const TVectorRegister& Other) const
+    //Upper half of the double width product of every lane. 16 bit lanes map to pmulhw / pmulhuw, 32 bit lanes multiply the even and
+    //odd lanes separately with pmuldq / pmuludq, 64 bit lanes are put together from four 32 bit partial products
+    template<typename TVector>
+    ATTRAVX TVector MultiplyHigh(const TVector& LHS, const TVector& RHS)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType> && ElementSize<TVector>() >= 2);
+
+        using VectorType = typename TVector::VectorType;
+
+        constexpr bool bSigned{std::is_signed_v<typename TVector::ElementType>};
+
+        if constexpr(ElementSize<TVector>() == 2)
+        {
+            if constexpr(alignof(TVector) == 32)
             {
-                return TVectorRegister{Vector & Other.Vector};
+                if constexpr(bSigned)
+                {
+                    return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pmulhw256(LHS.Vector, RHS.Vector))};
+                }
+                else if constexpr(!bSigned)
+                {
+                    return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pmulhuw256(LHS.Vector, RHS.Vector))};
+                }
             }
-
-            ATTRAVX TVectorRegister& operator&=(const TVectorRegister& Other)
+            else if constexpr(alignof(TVector) == 16)
             {
-                Vector &= Other.Vector;
-                return *this;
+                if constexpr(bSigned)
+                {
+                    return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pmulhw128(LHS.Vector, RHS.Vector))};
+                }
+                else if constexpr(!bSigned)
+                {
+                    return TVector{reinterpret_cast<VectorType>(__builtin_ia32_pmulhuw128(LHS.Vector, RHS.Vector))};
+                }
             }
+        }
+        else if constexpr(ElementSize<TVector>() == 4)
+        {
+            const auto Even{Internal::MultiplyEvenLanes<bSigned>(LHS.Vector, RHS.Vector)};
 
-            ATTRAVX TVectorRegister operator^(const TVectorRegister& Other) const
+            if constexpr(alignof(TVector) == 32)
             {
-                return TVectorRegister{Vector ^ Other.Vector};
-            }
+                const auto Odd{Internal::MultiplyEvenLanes<bSigned>(__builtin_shufflevector(LHS.Vector, LHS.Vector, 1, 1, 3, 3, 5, 5, 7, 7),
+                                                                    __builtin_shufflevector(RHS.Vector, RHS.Vector, 1, 1, 3, 3, 5, 5, 7, 7))};
 
-            ATTRAVX TVectorRegister& operator^=(const TVectorRegister& Other)
+                return TVector{__builtin_shufflevector(reinterpret_cast<VectorType>(Even), reinterpret_cast<VectorType>(Odd), 1, 9, 3, 11, 5, 13, 7, 15)};
+            }
+            else if constexpr(alignof(TVector) == 16)
             {
-                Vector ^= Other.Vector;
-                return *this;
+                const auto Odd{Internal::MultiplyEvenLanes<bSigned>(__builtin_shufflevector(LHS.Vector, LHS.Vector, 1, 1, 3, 3),
+                                                                    __builtin_shufflevector(RHS.Vector, RHS.Vector, 1, 1, 3, 3))};
+
+                return TVector{__builtin_shufflevector(reinterpret_cast<VectorType>(Even), reinterpret_cast<VectorType>(Odd), 1, 5, 3, 7)};
             }
+        }
+        else if constexpr(ElementSize<TVector>() == 8)
+        {
+            using UnsignedType = decltype(Internal::MultiplyEvenLanes<false>(LHS.Vector, RHS.Vector));
 
-            ATTRAVX TVectorRegister operator|(const TVectorRegister& Other) const
+            const UnsignedType Left{reinterpret_cast<UnsignedType>(LHS.Vector)};
+            const UnsignedType Right{reinterpret_cast<UnsignedType>(RHS.Vector)};
+
+            const UnsignedType LowLow{Internal::MultiplyEvenLanes<false>(Left, Right)};
+            const UnsignedType LowHigh{Internal::MultiplyEvenLanes<false>(Left, Right >> 32)};
+            const UnsignedType HighLow{Internal::MultiplyEvenLanes<false>(Left >> 32, Right)};
+            const UnsignedType HighHigh{Internal::MultiplyEvenLanes<false>(Left >> 32, Right >> 32)};
+
+            //the carry out of the middle 32 bits, none of the sums can overflow
+            const UnsignedType Middle{(LowLow >> 32) + (LowHigh & 0xFFFFFFFF) + (HighLow & 0xFFFFFFFF)};
+            const UnsignedType High{HighHigh + (LowHigh >> 32) + (HighLow >> 32) + (Middle >> 32)};
+
+            if constexpr(bSigned)
             {
-                return TVectorRegister{Vector | Other.Vector};
+                //a negative operand was read as 2^64 too large, which added the other operand to the upper half once
+                return TVector{reinterpret_cast<VectorType>(High) - ((LHS.Vector >> 63) & RHS.Vector) - ((RHS.Vector >> 63) & LHS.Vector)};
             }
-
-            ATTRAVX TVectorRegister& operator|=(const TVectorRegister& Other)
+            else if constexpr(!bSigned)
             {
-                Vector |= Other.Vector;
-                return *this;
+                return TVector{reinterpret_cast<VectorType>(High)};
             }
+        }
+    }
 
-            ATTRAVX TVectorRegister& operator>>=(const int32 ShuffleAmount)
+    //(LHS * RHS + 0x4000) >> 15 on signed 16 bit lanes, the Q15 fixed point multiply pmulhrsw
+    template<typename TVector>
+    ATTRAVX TVector MultiplyHighRound(const TVector& LHS, const TVector& RHS)
+    {
+        static_assert(std::is_signed_v<typename TVector::ElementType> && ElementSize<TVector>() == 2);
+
+        if constexpr(alignof(TVector) == 32)
+        {
+            return TVector{__builtin_ia32_pmulhrsw256(LHS.Vector, RHS.Vector)};
+        }
+        else if constexpr(alignof(TVector) == 16)
+        {
+            return TVector{__builtin_ia32_pmulhrsw128(LHS.Vector, RHS.Vector)};
+        }
+    }
+
+    //Multiplies the signed 16 bit lanes and adds neighbouring products into 32 bit lanes, pmaddwd
+    template<typename TVector>
+    ATTRAVX auto MultiplyAddPairs(const TVector& LHS, const TVector& RHS)
+    {
+        static_assert(std::is_same_v<typename TVector::ElementType, int16>);
+
+        if constexpr(alignof(TVector) == 32)
+        {
+            return int32_8{__builtin_ia32_pmaddwd256(LHS.Vector, RHS.Vector)};
+        }
+        else if constexpr(alignof(TVector) == 16)
+        {
+            return int32_4{__builtin_ia32_pmaddwd128(LHS.Vector, RHS.Vector)};
+        }
+    }
+
+    //Multiplies unsigned 8 bit lanes with signed 8 bit lanes and adds neighbouring products into saturated 16 bit lanes, pmaddubsw
+    template<typename TUnsignedVector, typename TSignedVector>
+    ATTRAVX auto MultiplyAddPairsSaturate(const TUnsignedVector& LHS, const TSignedVector& RHS)
+    {
+        static_assert(std::is_same_v<typename TUnsignedVector::ElementType, uint8> && std::is_same_v<typename TSignedVector::ElementType, int8>);
+
+        if constexpr(alignof(TUnsignedVector) == 32)
+        {
+            return int16_16{__builtin_ia32_pmaddubsw256(reinterpret_cast<Internal::char8_32>(LHS.Vector), reinterpret_cast<Internal::char8_32>(RHS.Vector))};
+        }
+        else if constexpr(alignof(TUnsignedVector) == 16)
+        {
+            return int16_8{__builtin_ia32_pmaddubsw128(reinterpret_cast<Internal::char8_16>(LHS.Vector), reinterpret_cast<Internal::char8_16>(RHS.Vector))};
+        }
+    }
+
+    namespace Internal
+    {
+        //pshufb of the 16 entry Table by every byte of Nibbles, all of which have to be below 16
+        template<typename TRaw>
+        ATTRAVX TRaw LookupNibbles(const uint8_16& Table, const TRaw& Nibbles)
+        {
+            if constexpr(sizeof(TRaw) == 32)
             {
-                Vector = ShuffleRight(*this, ShuffleAmount).Vector;
-                return *this;
+                const uint8_32 WideTable{__builtin_shufflevector(Table, Table, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15)};
+                return reinterpret_cast<TRaw>(__builtin_ia32_pshufb256(reinterpret_cast<char8_32>(WideTable), reinterpret_cast<char8_32>(Nibbles)));
             }
-
-            ATTRAVX TVectorRegister operator>>(const int32 ShuffleAmount)
+            else if constexpr(sizeof(TRaw) == 16)
             {
-                return TVectorRegister{ShuffleRight(*this, ShuffleAmount)};
+                return reinterpret_cast<TRaw>(__builtin_ia32_pshufb128(reinterpret_cast<char8_16>(Table), reinterpret_cast<char8_16>(Nibbles)));
             }
+        }
 
-            ATTRAVX TVectorRegister& operator<<=(const int32 ShuffleAmount)
+        //Leading zero counts of lanes twice as wide as the ones in Halves, the low half only counts when the high half is all zero
+        template<typename TRaw, typename THalves>
+        ATTRAVX TRaw CombineLeadingZeros(const THalves& Halves)
+        {
+            constexpr int32 HalfBits{static_cast<int32>(sizeof(Halves[0])) * 8};
+
+            const TRaw Lanes{reinterpret_cast<TRaw>(Halves)};
+            const TRaw High{Lanes >> HalfBits};
+            const TRaw Low{Lanes & ((TRaw{} + 1) << HalfBits) - 1};
+
+            return High + (Low & reinterpret_cast<TRaw>(High == HalfBits));
+        }
+    }
+
+    //Number of set bits in every lane. Uses vpopcnt with AVX512, otherwise a pshufb lookup per nibble whose byte counts are added up to the lane width
+    template<typename TVector>
+    ATTRAVX TVector PopCount(const TVector& Target)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
+
+#ifdef AVX512
+        if constexpr(alignof(TVector) == 32)
+        {
+            if constexpr(ElementSize<TVector>() == 1)
             {
-                Vector = ShuffleLeft(*this, ShuffleAmount).Vector;
-                return *this;
+                return Internal::MakeFromView<TVector>(__builtin_ia32_vpopcntb_256(Internal::ViewAs<TVector, Internal::char8_32>(Target)));
             }
-
-            ATTRAVX TVectorRegister operator<<(const int32 ShuffleAmount) const
+            else if constexpr(ElementSize<TVector>() == 2)
             {
-                return TVectorRegister{ShuffleLeft(*this, ShuffleAmount)};
+                return Internal::MakeFromView<TVector>(__builtin_ia32_vpopcntw_256(Internal::ViewAs<TVector, Internal::int16_16>(Target)));
             }
-
-            ATTRAVX TVectorRegister& operator+()
+            else if constexpr(ElementSize<TVector>() == 4)
             {
-                Vector = Simd::Absolute(*this).Vector;
-                return *this;
+                return Internal::MakeFromView<TVector>(__builtin_ia32_vpopcntd_256(Internal::ViewAs<TVector, Internal::int32_8>(Target)));
             }
-
-            ATTRAVX TVectorRegister& operator-()
+            else if constexpr(ElementSize<TVector>() == 8)
             {
-                Vector = ~Simd::Absolute(*this).Vector;
-                return *this;
+                return Internal::MakeFromView<TVector>(__builtin_ia32_vpopcntq_256(Internal::ViewAs<TVector, Internal::int64_4>(Target)));
+            }
+        }
+        else if constexpr(alignof(TVector) == 16)
+        {
+            if constexpr(ElementSize<TVector>() == 1)
+            {
+                return Internal::MakeFromView<TVector>(__builtin_ia32_vpopcntb_128(Internal::ViewAs<TVector, Internal::char8_16>(Target)));
+            }
+            else if constexpr(ElementSize<TVector>() == 2)
+            {
+                return Internal::MakeFromView<TVector>(__builtin_ia32_vpopcntw_128(Internal::ViewAs<TVector, Internal::int16_8>(Target)));
             }
+            else if constexpr(ElementSize<TVector>() == 4)
+            {
+                return Internal::MakeFromView<TVector>(__builtin_ia32_vpopcntd_128(Internal::ViewAs<TVector, Internal::int32_4>(Target)));
+            }
+            else if constexpr(ElementSize<TVector>() == 8)
+            {
+                return Internal::MakeFromView<TVector>(__builtin_ia32_vpopcntq_128(Internal::ViewAs<TVector, Internal::int64_2>(Target)));
+            }
+        }
+#else
+        constexpr uint64 NumBytes{sizeof(TVector)};
 
-            ATTRAVX void operator--()
+        using ByteType = Internal::TRawVector<uint8, NumBytes>;
+
+        const Internal::uint8_16 BitsPerNibble{0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+        const ByteType Bytes{Internal::ViewAs<TVector, ByteType>(Target)};
+        const ByteType ByteCounts{Internal::LookupNibbles(BitsPerNibble, Bytes & 0x0F) + Internal::LookupNibbles(BitsPerNibble, Bytes >> 4)};
+
+        if constexpr(ElementSize<TVector>() == 1)
+        {
+            return Internal::MakeFromView<TVector>(ByteCounts);
+        }
+        else if constexpr(ElementSize<TVector>() == 2 || ElementSize<TVector>() == 4)
+        {
+            using WordType = Internal::TRawVector<uint16, NumBytes / 2>;
+
+            const WordType Words{reinterpret_cast<WordType>(ByteCounts)};
+            const WordType WordCounts{(Words & 0xFF) + (Words >> 8)};
+
+            if constexpr(ElementSize<TVector>() == 2)
             {
-                Vector -= Simd::SetAll<TVectorRegister>(1);
+                return Internal::MakeFromView<TVector>(WordCounts);
             }
+            else if constexpr(ElementSize<TVector>() == 4)
+            {
+                using DoubleWordType = Internal::TRawVector<uint32, NumBytes / 4>;
 
-            ATTRAVX void operator++()
+                const DoubleWordType DoubleWords{reinterpret_cast<DoubleWordType>(WordCounts)};
+                return Internal::MakeFromView<TVector>((DoubleWords & 0xFFFF) + (DoubleWords >> 16));
+            }
+        }
+        else if constexpr(ElementSize<TVector>() == 8)
+        {
+            //psadbw against zero sums the 8 byte counts of every quad word
+            if constexpr(alignof(TVector) == 32)
             {
-                Vector += Simd::SetAll<TVectorRegister>(1);
+                return Internal::MakeFromView<TVector>(__builtin_ia32_psadbw256(reinterpret_cast<Internal::char8_32>(ByteCounts), Internal::char8_32{}));
             }
+            else if constexpr(alignof(TVector) == 16)
+            {
+                return Internal::MakeFromView<TVector>(__builtin_ia32_psadbw128(reinterpret_cast<Internal::char8_16>(ByteCounts), Internal::char8_16{}));
+            }
+        }
+#endif
+    }
 
-        public:
+    //Number of zero bits above the highest set bit of every lane, the lane width for a zero lane. Uses vplzcnt with AVX512 for 32 and
+    //64 bit lanes, otherwise counts the nibbles with pshufb and combines neighbouring counts up to the lane width
+    template<typename TVector>
+    ATTRAVX TVector CountLeadingZeros(const TVector& Target)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
 
-            VectorType Vector;
+#ifdef AVX512
+        if constexpr(ElementSize<TVector>() == 4 && alignof(TVector) == 32)
+        {
+            return Internal::MakeFromView<TVector>(__builtin_ia32_vplzcntd_256(Internal::ViewAs<TVector, Internal::int32_8>(Target)));
+        }
+        else if constexpr(ElementSize<TVector>() == 8 && alignof(TVector) == 32)
+        {
+            return Internal::MakeFromView<TVector>(__builtin_ia32_vplzcntq_256(Internal::ViewAs<TVector, Internal::int64_4>(Target)));
+        }
+        else if constexpr(ElementSize<TVector>() == 4 && alignof(TVector) == 16)
+        {
+            return Internal::MakeFromView<TVector>(__builtin_ia32_vplzcntd_128(Internal::ViewAs<TVector, Internal::int32_4>(Target)));
+        }
+        else if constexpr(ElementSize<TVector>() == 8 && alignof(TVector) == 16)
+        {
+            return Internal::MakeFromView<TVector>(__builtin_ia32_vplzcntq_128(Internal::ViewAs<TVector, Internal::int64_2>(Target)));
+        }
+#endif
+        constexpr uint64 NumBytes{sizeof(TVector)};
 
-        };
+        using ByteType = Internal::TRawVector<uint8, NumBytes>;
+        using WordType = Internal::TRawVector<uint16, NumBytes / 2>;
+        using DoubleWordType = Internal::TRawVector<uint32, NumBytes / 4>;
+        using QuadWordType = Internal::TRawVector<uint64, NumBytes / 8>;
+
+        const Internal::uint8_16 ZerosPerNibble{4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0};
+
+        const ByteType Bytes{Internal::ViewAs<TVector, ByteType>(Target)};
+        const ByteType High{Internal::LookupNibbles(ZerosPerNibble, Bytes >> 4)};
+        const ByteType Low{Internal::LookupNibbles(ZerosPerNibble, Bytes & 0x0F)};
+        const ByteType ByteZeros{High + (Low & reinterpret_cast<ByteType>(High == 4))};
+
+        if constexpr(ElementSize<TVector>() == 1)
+        {
+            return Internal::MakeFromView<TVector>(ByteZeros);
+        }
+        else if constexpr(ElementSize<TVector>() == 2)
+        {
+            return Internal::MakeFromView<TVector>(Internal::CombineLeadingZeros<WordType>(ByteZeros));
+        }
+        else if constexpr(ElementSize<TVector>() == 4)
+        {
+            return Internal::MakeFromView<TVector>(Internal::CombineLeadingZeros<DoubleWordType>(Internal::CombineLeadingZeros<WordType>(ByteZeros)));
+        }
+        else if constexpr(ElementSize<TVector>() == 8)
+        {
+            return Internal::MakeFromView<TVector>(Internal::CombineLeadingZeros<QuadWordType>(Internal::CombineLeadingZeros<DoubleWordType>(Internal::CombineLeadingZeros<WordType>(ByteZeros))));
+        }
+    }
+
+    //Number of zero bits below the lowest set bit of every lane, the lane width for a zero lane
+    template<typename TVector>
+    ATTRAVX TVector CountTrailingZeros(const TVector& Target)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
+
+        //~X & (X - 1) keeps exactly the trailing zeroes, set
+        return PopCount(TVector{~Target.Vector & (Target.Vector - 1)});
+    }
+
+    //Mirrors the bits of every lane, the backend lowers this to a byte shuffle and two pshufb nibble lookups
+    template<typename TVector>
+    ATTRAVX TVector BitReverse(const TVector& Target)
+    {
+        static_assert(std::is_integral_v<typename TVector::ElementType>);
 
+        return TVector{__builtin_elementwise_bitreverse(Target.Vector)};
     }
 
     #ifdef AVX128
@@ -27,11 +27,6 @@ FStaticString FStaticString::MakeFromRaw(const char8* RawString)
     return ResultString;
 }
 
-constexpr FStaticString::FStaticString()
-    : String(NULL_CHAR)
-{
-}
-
 FStaticString::FStaticString(Simd::char8_32 OtherString)
     : String(static_cast<Simd::char8_32&&>(OtherString))
 {
@@ -45,19 +40,17 @@ FStaticString& FStaticString::operator=(Simd::char8_32 OtherString)
 
 bool FStaticString::operator==(const FStaticString& Other) const
 {
-    return (String == Other.String) == ComparisonMask;
+    return (String == Other.String).All();
 }
 
 bool FStaticString::operator!=(const FStaticString& Other) const
 {
-    return (String != Other.String) == ComparisonMask;
+    return (String != Other.String).Any();
 }
 
 uint32 FStaticString::Length() const
 {
-    const int32 BitMask{String != 0_char8_32};
-
-    return Math::NumActiveBits(static_cast<uint32>(BitMask));
+    return (String != 0_char8_32).Count();
 }
 
 FStaticString& FStaticString::Append(const FStaticString& Other)
@@ -85,7 +78,7 @@ bool FStaticString::Contains(FStaticString Other) const
         ComparisonResult &= 1_char8_32;
         ComparisonResult *= String;
 
-        if EXPECT((ComparisonResult == Other.String) == ComparisonMask, false)
+        if EXPECT((ComparisonResult == Other.String).All(), false)
         {
             return true;
         }
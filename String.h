@@ -24,6 +24,12 @@ namespace StringUtility
 
     PURE uint64 Length(const char8* String);
 
+    //Bit N is set where byte N of the 64 byte block in Low and High equals the character in every lane of Broadcast
+    INLINE uint64 MatchMask(const Simd::char8_32& Low, const Simd::char8_32& High, const Simd::char8_32& Broadcast)
+    {
+        return static_cast<uint32>(static_cast<int32>(Low == Broadcast)) | static_cast<uint64>(static_cast<uint32>(static_cast<int32>(High == Broadcast))) << 32;
+    }
+
 }
 
 
@@ -42,6 +48,7 @@ public:
 
     explicit FStaticString(Simd::char8_32 OtherString);
 
+    //Builds the register lane by lane instead of copying, so a literal can initialise a constexpr FStaticString or a table built at compile time
     template<uint64 N>
     inline explicit constexpr FStaticString(const char8 (&StringSource)[N]);
 
@@ -103,18 +110,36 @@ public:
     void RemoveFromEnd(const int32 Num);
     void RemoveFromStart(const int32 Num);
 
+    inline const Simd::char8_32& GetCharacters() const
+    {
+        return String;
+    }
+
 private:
 
+    template<uint64 N, uint64... Indices>
+    inline constexpr FStaticString(const char8 (&StringSource)[N], std::integer_sequence<uint64, Indices...>);
+
     Simd::char8_32 String;
 
 };
 
+constexpr FStaticString::FStaticString()
+    : String(NULL_CHAR)
+{
+}
+
 template<uint64 N>
 constexpr FStaticString::FStaticString(const char8 (&StringSource)[N])
+    : FStaticString(StringSource, std::make_integer_sequence<uint64, NumCharacters>{})
 {
     static_assert(N <= NumCharacters);
+}
 
-    Memory::Copy(&String.Vector, StringSource, N);
+template<uint64 N, uint64... Indices>
+constexpr FStaticString::FStaticString(const char8 (&StringSource)[N], std::integer_sequence<uint64, Indices...>)
+    : String((Indices < N ? StringSource[Indices < N ? Indices : 0] : NULL_CHAR)...)
+{
 }
 
 template<uint64 N>
@@ -0,0 +1,317 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <bit>
+#include "String.h"
+
+//A string literal as a template argument, MakeStaticStringSwitch<"open", "close">() deduces one per key
+template<uint64 N>
+struct TStringLiteral final
+{
+    consteval TStringLiteral(const char8 (&Source)[N])
+    {
+        for(uint64 Index{0}; Index < N; ++Index)
+        {
+            Characters[Index] = Source[Index];
+        }
+    }
+
+    char8 Characters[N];
+};
+
+namespace StringUtility
+{
+    namespace Internal
+    {
+
+        //the 128 bit product folded to 64 bits, one mulx
+        constexpr uint64 MultiplyFold(const uint64 LHS, const uint64 RHS)
+        {
+            const uint128 Product{static_cast<uint128>(LHS) * RHS};
+            return static_cast<uint64>(Product) ^ static_cast<uint64>(Product >> 64);
+        }
+
+        //hashes the four 8 byte words of an FStaticString register, the constants keep a word of zeroes from zeroing its product
+        constexpr uint64 HashWords(const uint64 Word0, const uint64 Word1, const uint64 Word2, const uint64 Word3, const uint64 Seed)
+        {
+            return MultiplyFold(Word0 ^ Seed ^ 0xA0761D6478BD642Full, Word1 ^ 0xE7037ED1A0B428DBull)
+                ^ MultiplyFold(Word2 ^ 0x8EBC6AF09C88C6E3ull, Word3 ^ Seed ^ 0x589965CC75374CC3ull);
+        }
+
+        //bits 32 and up pick the bucket, the low bits xored with the pilot of the bucket pick the slot
+        constexpr uint64 BucketOf(const uint64 Hash, const uint64 NumBuckets)
+        {
+            return (Hash >> 32) & (NumBuckets - 1);
+        }
+
+        constexpr uint64 SlotOf(const uint64 Hash, const uint8 Pilot, const uint64 NumSlots)
+        {
+            return (Hash ^ (Pilot * 0x9E3779B97F4A7C15ull)) & (NumSlots - 1);
+        }
+
+        struct FKeyWords final
+        {
+            uint64 Words[4];
+        };
+
+        //the words an FStaticString built from Characters holds in its register, little endian and zero past the terminator
+        template<uint64 N>
+        constexpr FKeyWords LoadWords(const char8 (&Characters)[N])
+        {
+            FKeyWords Result{};
+
+            for(uint64 Index{0}; Index < N; ++Index)
+            {
+                Result.Words[Index / 8] |= static_cast<uint64>(static_cast<uint8>(Characters[Index])) << (Index % 8 * 8);
+            }
+
+            return Result;
+        }
+
+        template<uint64 N, uint64 M>
+        constexpr bool Equal(const char8 (&LHS)[N], const char8 (&RHS)[M])
+        {
+            if constexpr(N != M)
+            {
+                return false;
+            }
+
+            for(uint64 Index{0}; Index < N; ++Index)
+            {
+                if(LHS[Index] != RHS[Index])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        //Not constexpr, so reaching one during constant evaluation stops the compilation with its name in the error
+        inline void KeyIsNotACase()
+        {
+        }
+
+        inline void DuplicateKey()
+        {
+        }
+
+        inline void NoPerfectHashFound()
+        {
+        }
+
+    }
+}
+
+//Maps a fixed set of up to 31 character keys to their position in the template argument list with a perfect hash built at compile time.
+//Find hashes the key register once, loads the pilot byte of its bucket and does a single 32 byte compare against the only slot the key can be in.
+//The table is built by hash and displace: buckets are placed largest first, each trying pilots until all its keys land in free slots,
+//and a new seed is drawn when a bucket runs out of pilots. The quadratic duplicate check dominates the build, 500 keys still fit within
+//clang's default constexpr step limit
+template<TStringLiteral... Keys>
+class TStaticStringSwitch final
+{
+public:
+
+    static_assert(sizeof...(Keys) > 0);
+
+    inline static constexpr int32 NotFound{-1};
+    inline static constexpr uint64 NumKeys{sizeof...(Keys)};
+
+    //at most 80 percent of the slots are used so most buckets find a pilot within the first few tries
+    inline static constexpr uint64 NumSlots{std::bit_ceil(NumKeys + NumKeys / 4 + 1)};
+    inline static constexpr uint64 NumBuckets{NumKeys < 4 ? 1 : std::bit_ceil(NumKeys) / 2};
+
+    //The position of Key in the template arguments, NotFound for every other string
+    ATTRAVX int32 Find(const FStaticString& Key) const
+    {
+        const Simd::uint64_4 Words{Simd::Reinterpret<Simd::uint64_4>(Key.GetCharacters())};
+        const uint64 Hash{StringUtility::Internal::HashWords(Words[0], Words[1], Words[2], Words[3], Table.Seed)};
+        const uint64 Slot{StringUtility::Internal::SlotOf(Hash, Table.Pilots[StringUtility::Internal::BucketOf(Hash, NumBuckets)], NumSlots)};
+
+        return (Table.Strings[Slot].GetCharacters() == Key.GetCharacters()).All() ? Table.Cases[Slot] : NotFound;
+    }
+
+    //The value Find returns for Key, made for case labels. Fails to compile when Key is not one of the template arguments
+    template<uint64 N>
+    static consteval int32 IndexOf(const char8 (&Key)[N])
+    {
+        //expanded into an array rather than a fold, clang limits folds to 256 operands
+        const bool bMatches[NumKeys]{StringUtility::Internal::Equal(Keys.Characters, Key)...};
+
+        int32 Found{NotFound};
+        for(uint64 Index{0}; Index < NumKeys && Found == NotFound; ++Index)
+        {
+            Found = bMatches[Index] ? static_cast<int32>(Index) : NotFound;
+        }
+
+        if(Found == NotFound)
+        {
+            StringUtility::Internal::KeyIsNotACase();
+        }
+
+        return Found;
+    }
+
+private:
+
+    struct FTable final
+    {
+        FStaticString Strings[NumSlots];
+
+        //the key position stored in every slot, NotFound for the empty ones
+        int16 Cases[NumSlots];
+
+        uint8 Pilots[NumBuckets];
+        uint64 Seed;
+    };
+
+    static consteval FTable Build()
+    {
+        const StringUtility::Internal::FKeyWords Words[NumKeys]{StringUtility::Internal::LoadWords(Keys.Characters)...};
+
+        for(uint64 First{0}; First < NumKeys; ++First)
+        {
+            for(uint64 Second{First + 1}; Second < NumKeys; ++Second)
+            {
+                if(Words[First].Words[0] == Words[Second].Words[0] && Words[First].Words[1] == Words[Second].Words[1]
+                    && Words[First].Words[2] == Words[Second].Words[2] && Words[First].Words[3] == Words[Second].Words[3])
+                {
+                    StringUtility::Internal::DuplicateKey();
+                }
+            }
+        }
+
+        const FStaticString KeyStrings[NumKeys]{FStaticString{Keys.Characters}...};
+
+        for(uint64 Attempt{0}; Attempt < 64; ++Attempt)
+        {
+            FTable Table{};
+            Table.Seed = StringUtility::Internal::MultiplyFold(Attempt + 1, 0x9E3779B97F4A7C15ull);
+
+            uint64 Hashes[NumKeys]{};
+            uint64 BucketSizes[NumBuckets]{};
+            uint64 LargestBucket{0};
+
+            for(uint64 Key{0}; Key < NumKeys; ++Key)
+            {
+                Hashes[Key] = StringUtility::Internal::HashWords(Words[Key].Words[0], Words[Key].Words[1], Words[Key].Words[2], Words[Key].Words[3], Table.Seed);
+
+                const uint64 Size{++BucketSizes[StringUtility::Internal::BucketOf(Hashes[Key], NumBuckets)]};
+                LargestBucket = Size > LargestBucket ? Size : LargestBucket;
+            }
+
+            //the keys sorted by bucket, so trying a pilot only walks the keys of its bucket
+            uint64 BucketStarts[NumBuckets + 1]{};
+            for(uint64 Bucket{0}; Bucket < NumBuckets; ++Bucket)
+            {
+                BucketStarts[Bucket + 1] = BucketStarts[Bucket] + BucketSizes[Bucket];
+            }
+
+            uint64 BucketHashes[NumKeys]{};
+            {
+                uint64 Filled[NumBuckets]{};
+                for(uint64 Key{0}; Key < NumKeys; ++Key)
+                {
+                    const uint64 Bucket{StringUtility::Internal::BucketOf(Hashes[Key], NumBuckets)};
+                    BucketHashes[BucketStarts[Bucket] + Filled[Bucket]++] = Hashes[Key];
+                }
+            }
+
+            bool bTaken[NumSlots]{};
+            bool bPlaced{true};
+
+            for(uint64 Size{LargestBucket}; Size > 0 && bPlaced; --Size)
+            {
+                for(uint64 Bucket{0}; Bucket < NumBuckets && bPlaced; ++Bucket)
+                {
+                    if(BucketSizes[Bucket] != Size)
+                    {
+                        continue;
+                    }
+
+                    bPlaced = false;
+
+                    for(uint32 Pilot{0}; Pilot < 256 && !bPlaced; ++Pilot)
+                    {
+                        //the slots this pilot gives the bucket's keys must be free and differ from each other. Only the slots claimed
+                        //by this attempt are released when it fails, the rest belong to buckets placed before
+                        uint64 Claimed{BucketStarts[Bucket]};
+                        bool bFits{true};
+
+                        for(; Claimed < BucketStarts[Bucket + 1]; ++Claimed)
+                        {
+                            const uint64 Slot{StringUtility::Internal::SlotOf(BucketHashes[Claimed], static_cast<uint8>(Pilot), NumSlots)};
+
+                            if(bTaken[Slot])
+                            {
+                                bFits = false;
+                                break;
+                            }
+
+                            bTaken[Slot] = true;
+                        }
+
+                        if(bFits)
+                        {
+                            Table.Pilots[Bucket] = static_cast<uint8>(Pilot);
+                            bPlaced = true;
+                        }
+                        else
+                        {
+                            for(uint64 Key{BucketStarts[Bucket]}; Key < Claimed; ++Key)
+                            {
+                                bTaken[StringUtility::Internal::SlotOf(BucketHashes[Key], static_cast<uint8>(Pilot), NumSlots)] = false;
+                            }
+                        }
+                    }
+                }
+            }
+
+            if(!bPlaced)
+            {
+                continue;
+            }
+
+            for(uint64 Slot{0}; Slot < NumSlots; ++Slot)
+            {
+                Table.Cases[Slot] = NotFound;
+            }
+
+            for(uint64 Key{0}; Key < NumKeys; ++Key)
+            {
+                const uint64 Bucket{StringUtility::Internal::BucketOf(Hashes[Key], NumBuckets)};
+                const uint64 Slot{StringUtility::Internal::SlotOf(Hashes[Key], Table.Pilots[Bucket], NumSlots)};
+
+                Table.Strings[Slot] = KeyStrings[Key];
+                Table.Cases[Slot] = static_cast<int16>(Key);
+            }
+
+            return Table;
+        }
+
+        StringUtility::Internal::NoPerfectHashFound();
+        return FTable{};
+    }
+
+    inline static constexpr FTable Table{Build()};
+
+};
+
+template<TStringLiteral... Keys>
+consteval TStaticStringSwitch<Keys...> MakeStaticStringSwitch()
+{
+    return TStaticStringSwitch<Keys...>{};
+}
@@ -0,0 +1,159 @@
+#include "Structural.h"
+
+namespace
+{
+    constexpr uint64 EvenBits{0x5555555555555555};
+
+    INLINE bool IsWhitespace(const char8 Character)
+    {
+        return Character == ' ' || Character == '\t' || Character == '\n' || Character == '\r';
+    }
+}
+
+FCharacterMasks Structural::Classify(const char8* Chunk, const char8 Delimiter)
+{
+    const Simd::char8_32 Low{Simd::Load<Simd::char8_32>(Chunk)};
+    const Simd::char8_32 High{Simd::Load<Simd::char8_32>(Chunk + 32)};
+
+    const auto Match = [&Low, &High](const char8 Character) -> uint64
+    {
+        return StringUtility::MatchMask(Low, High, Simd::char8_32{Character});
+    };
+
+    FCharacterMasks Masks;
+    Masks.Quotes = Match('"');
+    Masks.Backslashes = Match('\\');
+    Masks.Newlines = Match('\n');
+    Masks.Delimiters = Match(Delimiter);
+    Masks.Whitespace = Match(' ') | Match('\t') | Match('\r') | Masks.Newlines;
+    Masks.Structurals = Match('{') | Match('}') | Match('[') | Match(']') | Match(':') | Match(',');
+
+    return Masks;
+}
+
+uint64 Structural::PrefixXor(const uint64 Bits)
+{
+    //multiplying by all ones without carries xors every bit into all the ones above it
+    const Simd::Internal::int64_2 Product{__builtin_ia32_pclmulqdq128(Simd::Internal::int64_2{static_cast<int64>(Bits), 0}, Simd::Internal::int64_2{-1, -1}, 0)};
+    return static_cast<uint64>(Product[0]);
+}
+
+Structural::FScanner::FScanner(const EFormat InFormat, const char8 InDelimiter)
+    : Format(InFormat)
+    , Delimiter(InDelimiter)
+    , NextEscaped(0)
+    , InsideString(0)
+    , PreviousScalar(0)
+{
+}
+
+uint64 Structural::FScanner::FindEscaped(uint64 Backslashes)
+{
+    if(Backslashes == 0)
+    {
+        const uint64 Escaped{NextEscaped};
+        NextEscaped = 0;
+        return Escaped;
+    }
+
+    //a backslash that is itself escaped doesn't start a sequence, the others escape the character after an odd long run of them.
+    //Adding the odd sequence starts to the backslashes carries through each run and tells its parity by where it ends
+    Backslashes &= ~NextEscaped;
+
+    const uint64 FollowsEscape{Backslashes << 1 | NextEscaped};
+    const uint64 OddSequenceStarts{Backslashes & ~EvenBits & ~FollowsEscape};
+
+    uint64 SequencesStartingOnEvenBits;
+    NextEscaped = __builtin_add_overflow(OddSequenceStarts, Backslashes, &SequencesStartingOnEvenBits);
+
+    const uint64 InvertMask{SequencesStartingOnEvenBits << 1};
+    return (EvenBits ^ InvertMask) & FollowsEscape;
+}
+
+uint64 Structural::FScanner::ScanChunk(const char8* Chunk)
+{
+    const FCharacterMasks Masks{Classify(Chunk, Delimiter)};
+
+    const uint64 Quotes{Format == EFormat::Json ? Masks.Quotes & ~FindEscaped(Masks.Backslashes) : Masks.Quotes};
+
+    //set from the opening quote up to the character before the closing one
+    const uint64 Inside{PrefixXor(Quotes) ^ InsideString};
+    InsideString = static_cast<uint64>(static_cast<int64>(Inside) >> 63);
+
+    if(Format == EFormat::Csv)
+    {
+        return (Masks.Delimiters | Masks.Newlines) & ~Inside;
+    }
+
+    //a scalar starts at every character that is neither an operator nor whitespace and doesn't follow another such character
+    const uint64 Scalars{~(Masks.Structurals | Masks.Whitespace)};
+    const uint64 NonQuoteScalars{Scalars & ~Quotes};
+
+    const uint64 FollowsScalar{NonQuoteScalars << 1 | PreviousScalar};
+    PreviousScalar = NonQuoteScalars >> 63;
+
+    //the string contents and the closing quote are dropped, the opening quote stays as the start of the string
+    const uint64 StringTail{Inside ^ Quotes};
+
+    return (Masks.Structurals | (Scalars & ~FollowsScalar)) & ~StringTail;
+}
+
+uint64 Structural::FScanner::Scan(const char8* Data, const uint32 Size, uint32* Out)
+{
+    uint64 NumIndices{0};
+
+    const auto Flatten = [&NumIndices, Out](uint64 Bits, const uint32 Base)
+    {
+        for(; Bits != 0; Bits &= Bits - 1)
+        {
+            Out[NumIndices++] = Base + static_cast<uint32>(__builtin_ctzll(Bits));
+        }
+    };
+
+    uint32 Offset{0};
+    for(; Offset + ChunkSize <= Size; Offset += ChunkSize)
+    {
+        Flatten(ScanChunk(Data + Offset), Offset);
+    }
+
+    if(Offset < Size)
+    {
+        //spaces are neither boundaries nor scalars in either format
+        alignas(32) char8 Padded[ChunkSize];
+        Memory::Set(Padded, ' ', ChunkSize);
+        Memory::Copy(Padded, Data + Offset, Size - Offset);
+
+        Flatten(ScanChunk(Padded) & ((1ull << (Size - Offset)) - 1), Offset);
+    }
+
+    return NumIndices;
+}
+
+Structural::FToken Structural::MakeToken(const char8* Data, uint32 Begin, uint32 End)
+{
+    while(Begin < End && IsWhitespace(Data[Begin]))
+    {
+        ++Begin;
+    }
+
+    while(End > Begin && IsWhitespace(Data[End - 1]))
+    {
+        --End;
+    }
+
+    return FToken{Begin, End - Begin};
+}
+
+bool Structural::ToStaticString(const char8* Data, const FToken& Token, FStaticString& Out)
+{
+    //the last character stays the terminator
+    if(Token.Length >= FStaticString::NumCharacters)
+    {
+        return false;
+    }
+
+    Out = Simd::char8_32{};
+    Memory::Copy(Out.RawString(), Data + Token.Begin, Token.Length);
+
+    return true;
+}
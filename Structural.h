@@ -0,0 +1,91 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+
+#pragma once
+
+#include "String.h"
+
+//One bit per byte of a 64 byte chunk, bit N stands for byte N
+struct FCharacterMasks final
+{
+    uint64 Quotes;
+    uint64 Backslashes;
+    uint64 Structurals; //the JSON operators {}[]:,
+    uint64 Whitespace;
+    uint64 Delimiters;
+    uint64 Newlines;
+};
+
+//Stage one of a JSON or CSV parser, the same split as simdjson: the input is classified 64 bytes at a time into bitmasks, quoted
+//regions are masked out with a carry-less multiply and the remaining token boundaries are written out as an index array
+namespace Structural
+{
+
+    enum class EFormat : uint8
+    {
+        Json, //boundaries are the operators, the opening quote of every string and the first character of every other scalar
+        Csv   //boundaries are the delimiters and newlines outside of quoted fields, "" inside quotes is an escaped quote
+    };
+
+    inline constexpr uint64 ChunkSize{64};
+
+    FCharacterMasks Classify(const char8* Chunk, const char8 Delimiter);
+
+    //Bit N of the result is the xor of the bits 0 to N, which turns quote positions into the inside of the quoted regions
+    uint64 PrefixXor(const uint64 Bits);
+
+    class FScanner final
+    {
+    public:
+
+        explicit FScanner(const EFormat InFormat, const char8 InDelimiter = ',');
+
+        //Writes the boundary positions in Data to Out, which needs room for Size positions, and returns their number.
+        //Escapes and open strings carry over between calls, so a large input can be fed in pieces whose sizes are multiples of ChunkSize
+        //except for the last one. Positions are relative to each Data
+        uint64 Scan(const char8* Data, const uint32 Size, uint32* Out);
+
+        //True when the input so far ends inside a quoted string
+        inline bool IsInsideString() const
+        {
+            return InsideString != 0;
+        }
+
+    private:
+
+        uint64 ScanChunk(const char8* Chunk);
+
+        uint64 FindEscaped(uint64 Backslashes);
+
+        EFormat Format;
+        char8 Delimiter;
+
+        uint64 NextEscaped;
+        uint64 InsideString;
+        uint64 PreviousScalar;
+    };
+
+    struct FToken final
+    {
+        uint32 Begin;
+        uint32 Length;
+    };
+
+    //The text from Begin up to End with whitespace trimmed on both sides, for the span between two boundaries
+    FToken MakeToken(const char8* Data, const uint32 Begin, const uint32 End);
+
+    //Copies the token into Out when it fits into an FStaticString, returns false when it is too long
+    bool ToStaticString(const char8* Data, const FToken& Token, FStaticString& Out);
+
+}
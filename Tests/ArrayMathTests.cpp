@@ -0,0 +1,96 @@
+#include "Test.h"
+#include "../ArrayMath.h"
+
+namespace
+{
+    //sizes around the four chunk loop, the single chunk loop and the masked tail
+    constexpr uint64 Sizes[]{0, 1, 7, 8, 9, 31, 32, 33, 45, 100};
+    constexpr uint64 MaxSize{100};
+
+    void Fill(float32* Data, const uint64 Num, const float32 Scale)
+    {
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            Data[Index] = static_cast<float32>(Index % 13) * Scale - 3.f;
+        }
+    }
+}
+
+TEST(ArrayMathFused)
+{
+    float32 A[MaxSize];
+    float32 B[MaxSize];
+    float32 C[MaxSize];
+    float32 D[MaxSize];
+    Fill(A, MaxSize, 0.5f);
+    Fill(B, MaxSize, 1.25f);
+    Fill(C, MaxSize, -0.75f);
+    Fill(D, MaxSize, 2.f);
+
+    for(const uint64 Num : Sizes)
+    {
+        //the guard past the end catches any store outside the masked tail
+        float32 Out[MaxSize + 1];
+        Out[Num] = 12345.f;
+
+        const ArrayMath::FConstArraySpan SpanA{A, Num};
+        const ArrayMath::FConstArraySpan SpanB{B, Num};
+        const ArrayMath::FConstArraySpan SpanC{C, Num};
+        const ArrayMath::FConstArraySpan SpanD{D, Num};
+        ArrayMath::FArraySpan Result{Out, Num};
+
+        Result = SpanA * SpanB + SpanC * SpanD;
+
+        bool bMatches{Out[Num] == 12345.f};
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            bMatches = bMatches && __builtin_fabsf(Out[Index] - (A[Index] * B[Index] + C[Index] * D[Index])) <= 1e-4f;
+        }
+        CHECK(bMatches);
+
+        Result = 2.f - SpanA * SpanB;
+
+        bMatches = Out[Num] == 12345.f;
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            bMatches = bMatches && __builtin_fabsf(Out[Index] - (2.f - A[Index] * B[Index])) <= 1e-4f;
+        }
+        CHECK(bMatches);
+    }
+}
+
+TEST(ArrayMathOperations)
+{
+    float32 A[MaxSize];
+    float32 B[MaxSize];
+    Fill(A, MaxSize, 0.5f);
+    Fill(B, MaxSize, 1.25f);
+
+    float32 Out[MaxSize];
+    const ArrayMath::FConstArraySpan SpanA{A, MaxSize};
+    const ArrayMath::FConstArraySpan SpanB{B, MaxSize};
+    ArrayMath::FArraySpan Result{Out, MaxSize};
+
+    Result = ArrayMath::SquareRoot(ArrayMath::Absolute(SpanA)) + ArrayMath::Min(SpanA, SpanB) - ArrayMath::Max(-SpanB, 1.f) / 4.f;
+
+    bool bMatches{true};
+    for(uint64 Index{0}; Index < MaxSize; ++Index)
+    {
+        const float32 Expected{__builtin_sqrtf(__builtin_fabsf(A[Index])) + __builtin_fminf(A[Index], B[Index]) - __builtin_fmaxf(-B[Index], 1.f) / 4.f};
+        bMatches = bMatches && __builtin_fabsf(Out[Index] - Expected) <= 1e-4f;
+    }
+    CHECK(bMatches);
+
+    //the destination as its own operand reads every chunk before writing it
+    Result = SpanA;
+    Result *= 3.f;
+    Result += Result;
+    Result -= SpanA;
+
+    bMatches = true;
+    for(uint64 Index{0}; Index < MaxSize; ++Index)
+    {
+        bMatches = bMatches && Out[Index] == A[Index] * 5.f;
+    }
+    CHECK(bMatches);
+}
@@ -0,0 +1,166 @@
+#include "Test.h"
+#include "../BitArray.h"
+
+#include <vector>
+
+namespace
+{
+    //whole registers, a partial last register and less than one word
+    constexpr uint64 Sizes[]{1, 63, 256, 1000, 256 * 3 + 77};
+
+    uint64 NextValue(uint64& State)
+    {
+        State ^= State << 13;
+        State ^= State >> 7;
+        State ^= State << 17;
+        return State;
+    }
+
+    void Fill(Simd::TBitArray<>& Bits, std::vector<bool>& Reference, uint64 State)
+    {
+        for(uint64 Index{0}; Index < Bits.Num(); ++Index)
+        {
+            const bool bValue{NextValue(State) % 3 == 0};
+            Bits.Set(Index, bValue);
+            Reference[Index] = bValue;
+        }
+    }
+
+    //Get, PopCount and both set bit walks, a stray bit past Num would show up in all but Get
+    bool MatchesReference(const Simd::TBitArray<>& Bits, const std::vector<bool>& Reference)
+    {
+        bool bMatches{true};
+
+        std::vector<uint64> Expected;
+        for(uint64 Index{0}; Index < Bits.Num(); ++Index)
+        {
+            bMatches = bMatches && Bits.Get(Index) == Reference[Index];
+            if(Reference[Index])
+            {
+                Expected.push_back(Index);
+            }
+        }
+
+        std::vector<uint64> Iterated;
+        for(const uint64 Index : Bits.SetBits())
+        {
+            Iterated.push_back(Index);
+        }
+
+        std::vector<uint64> Visited;
+        Bits.ForEachSetBit([&Visited](const uint64 Index)
+        {
+            Visited.push_back(Index);
+        });
+
+        return bMatches && Bits.PopCount() == Expected.size() && Iterated == Expected && Visited == Expected;
+    }
+}
+
+TEST(BitArrayLogicalOperations)
+{
+    bool bMatches{true};
+
+    for(const uint64 Num : Sizes)
+    {
+        Simd::TBitArray<> LHS{Num};
+        Simd::TBitArray<> RHS{Num};
+        std::vector<bool> Left(Num);
+        std::vector<bool> Right(Num);
+        Fill(LHS, Left, Num * 2 + 1);
+        Fill(RHS, Right, Num * 2 + 2);
+
+        uint64 Intersection{0};
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            Intersection += Left[Index] && Right[Index];
+        }
+        bMatches = bMatches && LHS.AndPopCount(RHS) == Intersection && MatchesReference(LHS, Left) && MatchesReference(RHS, Right);
+
+        const auto Apply = [&](auto Operation, auto Scalar)
+        {
+            Simd::TBitArray<> Result{Num};
+            std::vector<bool> Expected(Num);
+            Result |= LHS;
+            Operation(Result);
+
+            for(uint64 Index{0}; Index < Num; ++Index)
+            {
+                Expected[Index] = Scalar(Left[Index], Right[Index]);
+            }
+
+            return MatchesReference(Result, Expected);
+        };
+
+        bMatches = bMatches && Apply([&](Simd::TBitArray<>& Result){ Result &= RHS; }, [](const bool L, const bool R){ return L && R; });
+        bMatches = bMatches && Apply([&](Simd::TBitArray<>& Result){ Result |= RHS; }, [](const bool L, const bool R){ return L || R; });
+        bMatches = bMatches && Apply([&](Simd::TBitArray<>& Result){ Result ^= RHS; }, [](const bool L, const bool R){ return L != R; });
+        bMatches = bMatches && Apply([&](Simd::TBitArray<>& Result){ Result.AndNot(RHS); }, [](const bool L, const bool R){ return L && !R; });
+        bMatches = bMatches && Apply([](Simd::TBitArray<>& Result){ Result.ClearAll(); }, [](const bool, const bool){ return false; });
+    }
+
+    CHECK(bMatches);
+}
+
+TEST(BitArraySetMask)
+{
+    constexpr uint64 Num{300};
+
+    Simd::TBitArray<> Bits{Num};
+    std::vector<bool> Reference(Num);
+    Fill(Bits, Reference, 7);
+
+    const auto SetReference = [&Reference](const uint64 First, const uint32 Mask, const uint32 NumMaskBits)
+    {
+        for(uint32 Bit{0}; Bit < NumMaskBits && First + Bit < Num; ++Bit)
+        {
+            Reference[First + Bit] = (Mask >> Bit) & 1;
+        }
+    };
+
+    //inside a word, across a word boundary and past the end
+    bool bMatches{true};
+    uint64 State{11};
+    for(const uint64 First : {0ull, 5ull, 50ull, 60ull, 127ull, 280ull, 299ull})
+    {
+        const uint32 Mask{static_cast<uint32>(NextValue(State))};
+        Bits.SetMask(First, static_cast<int32>(Mask), 32);
+        SetReference(First, Mask, 32);
+        bMatches = bMatches && MatchesReference(Bits, Reference);
+
+        Bits.SetMask(First, static_cast<int32>(Mask >> 8), 5);
+        SetReference(First, Mask >> 8, 5);
+        bMatches = bMatches && MatchesReference(Bits, Reference);
+    }
+    CHECK(bMatches);
+
+    //one bit per lane whatever the movemask gives, 16 bit lanes go through pext
+    const Simd::int16_16 Shorts{0, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 0};
+    Bits.SetMask(62, Shorts == Simd::int16_16{static_cast<int16>(1)});
+    SetReference(62, 0b0111000100111010, 16);
+    CHECK(MatchesReference(Bits, Reference));
+
+    const Simd::int16_8 Narrow{1, 0, 0, 1, 1, 0, 1, 1};
+    Bits.SetMask(200, Narrow == Simd::int16_8{static_cast<int16>(1)});
+    SetReference(200, 0b11011001, 8);
+    CHECK(MatchesReference(Bits, Reference));
+
+    const Simd::int32_8 Ints{5, 0, 5, 5, 0, 0, 0, 5};
+    Bits.SetMask(125, Ints == Simd::int32_8{5});
+    SetReference(125, 0b10001101, 8);
+    CHECK(MatchesReference(Bits, Reference));
+
+    Simd::uint8_32 Bytes;
+    for(uint64 Lane{0}; Lane < Simd::uint8_32::NumElements; ++Lane)
+    {
+        Bytes[Lane] = Lane % 2 == 0 ? 1 : 0;
+    }
+    Bits.SetMask(290, Bytes == Simd::uint8_32{static_cast<uint8>(1)});
+    SetReference(290, 0x55555555, 32);
+    CHECK(MatchesReference(Bits, Reference));
+
+    const Simd::int64_4 Longs{1, 2, 1, 1};
+    Bits.SetMask(30, Longs == Simd::int64_4{static_cast<int64>(1)});
+    SetReference(30, 0b1101, 4);
+    CHECK(MatchesReference(Bits, Reference));
+}
@@ -0,0 +1,280 @@
+#include "Test.h"
+#include "../Culling.h"
+#include "../Math.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    //12 whole chunks and a partial one
+    constexpr uint64 NumShapes{101};
+
+    //quarters and small integers keep every product and sum exact in float32, so the scalar references agree with the kernels on every edge case
+    float32 MakeValue(const uint64 Seed, const int32 Range)
+    {
+        return static_cast<float32>(static_cast<int32>((Seed * 0x9E3779B97F4A7C15ull) >> 40) % (Range * 8)) * 0.25f - static_cast<float32>(Range);
+    }
+
+    struct FBoxes final
+    {
+        explicit FBoxes(const uint64 Seed)
+        {
+            for(uint64 Index{0}; Index < NumShapes; ++Index)
+            {
+                for(int32 Axis{0}; Axis < 3; ++Axis)
+                {
+                    Centers[Axis].push_back(MakeValue(Seed + Index * 7 + Axis, 8));
+                    Extents[Axis].push_back(MakeValue(Seed + Index * 7 + Axis + 3, 2) + 2.f);
+                }
+            }
+        }
+
+        FBoxArray View() const
+        {
+            return FBoxArray{Centers[0].data(), Centers[1].data(), Centers[2].data(), Extents[0].data(), Extents[1].data(), Extents[2].data(), NumShapes};
+        }
+
+        std::vector<float32> Centers[3];
+        std::vector<float32> Extents[3];
+    };
+
+    struct FSpheres final
+    {
+        explicit FSpheres(const uint64 Seed)
+        {
+            for(uint64 Index{0}; Index < NumShapes; ++Index)
+            {
+                for(int32 Axis{0}; Axis < 3; ++Axis)
+                {
+                    Centers[Axis].push_back(MakeValue(Seed + Index * 5 + Axis, 8));
+                }
+                Radius.push_back(MakeValue(Seed + Index * 5 + 3, 2) + 2.f);
+            }
+        }
+
+        FSphereArray View() const
+        {
+            return FSphereArray{Centers[0].data(), Centers[1].data(), Centers[2].data(), Radius.data(), NumShapes};
+        }
+
+        std::vector<float32> Centers[3];
+        std::vector<float32> Radius;
+    };
+
+    //a pyramid looking down +Z with a near and a far plane
+    const FFrustum Frustum
+    {{
+        FVector4{1.f, 0.f, 1.f, 2.f},
+        FVector4{-1.f, 0.f, 1.f, 2.f},
+        FVector4{0.f, 1.f, 1.f, 2.f},
+        FVector4{0.f, -1.f, 1.f, 2.f},
+        FVector4{0.f, 0.f, 1.f, 1.f},
+        FVector4{0.f, 0.f, -1.f, 6.f}
+    }};
+
+    float32 PlaneDistance(const FVector4& Plane, const float32 X, const float32 Y, const float32 Z)
+    {
+        return Plane.X() * X + Plane.Y() * Y + Plane.Z() * Z + Plane.W();
+    }
+
+    bool FrustumBox(const FBoxes& Boxes, const uint64 Index)
+    {
+        bool bInside{true};
+        for(const FVector4& Plane : Frustum.Planes)
+        {
+            const float32 Radius{Boxes.Extents[0][Index] * std::fabs(Plane.X()) + Boxes.Extents[1][Index] * std::fabs(Plane.Y()) + Boxes.Extents[2][Index] * std::fabs(Plane.Z())};
+            bInside = bInside && PlaneDistance(Plane, Boxes.Centers[0][Index], Boxes.Centers[1][Index], Boxes.Centers[2][Index]) + Radius >= 0.f;
+        }
+        return bInside;
+    }
+
+    bool FrustumSphere(const FSpheres& Spheres, const uint64 Index)
+    {
+        bool bInside{true};
+        for(const FVector4& Plane : Frustum.Planes)
+        {
+            bInside = bInside && PlaneDistance(Plane, Spheres.Centers[0][Index], Spheres.Centers[1][Index], Spheres.Centers[2][Index]) + Spheres.Radius[Index] >= 0.f;
+        }
+        return bInside;
+    }
+
+    bool RayBox(const FRay& Ray, const FBoxes& Boxes, const uint64 Index)
+    {
+        float32 Near{0.f};
+        float32 Far{Ray.MaxDistance};
+        for(int32 Axis{0}; Axis < 3; ++Axis)
+        {
+            const float32 Entry{(Boxes.Centers[Axis][Index] - Boxes.Extents[Axis][Index] - Ray.Origin.Vector[Axis]) / Ray.Direction.Vector[Axis]};
+            const float32 Exit{(Boxes.Centers[Axis][Index] + Boxes.Extents[Axis][Index] - Ray.Origin.Vector[Axis]) / Ray.Direction.Vector[Axis]};
+            Near = std::max(Near, std::min(Entry, Exit));
+            Far = std::min(Far, std::max(Entry, Exit));
+        }
+        return Near <= Far;
+    }
+
+    bool RaySphere(const FRay& Ray, const FSpheres& Spheres, const uint64 Index)
+    {
+        float32 Offset[3];
+        float32 Projection{0.f};
+        for(int32 Axis{0}; Axis < 3; ++Axis)
+        {
+            Offset[Axis] = Spheres.Centers[Axis][Index] - Ray.Origin.Vector[Axis];
+            Projection += Offset[Axis] * Ray.Direction.Vector[Axis];
+        }
+
+        const float32 Closest{std::min(std::max(Projection / Ray.Direction.Dot3(Ray.Direction), 0.f), Ray.MaxDistance)};
+
+        float32 DistanceSquared{0.f};
+        for(int32 Axis{0}; Axis < 3; ++Axis)
+        {
+            const float32 Delta{Offset[Axis] - Closest * Ray.Direction.Vector[Axis]};
+            DistanceSquared += Delta * Delta;
+        }
+        return DistanceSquared <= Spheres.Radius[Index] * Spheres.Radius[Index];
+    }
+
+    bool BoxBox(const FVector4& Center, const FVector4& Extent, const FBoxes& Boxes, const uint64 Index)
+    {
+        bool bOverlaps{true};
+        for(int32 Axis{0}; Axis < 3; ++Axis)
+        {
+            bOverlaps = bOverlaps && std::fabs(Boxes.Centers[Axis][Index] - Center.Vector[Axis]) <= Boxes.Extents[Axis][Index] + Extent.Vector[Axis];
+        }
+        return bOverlaps;
+    }
+
+    bool BoxSphere(const FVector4& Center, const FVector4& Extent, const FSpheres& Spheres, const uint64 Index)
+    {
+        float32 DistanceSquared{0.f};
+        for(int32 Axis{0}; Axis < 3; ++Axis)
+        {
+            const float32 Outside{std::max(std::fabs(Spheres.Centers[Axis][Index] - Center.Vector[Axis]) - Extent.Vector[Axis], 0.f)};
+            DistanceSquared += Outside * Outside;
+        }
+        return DistanceSquared <= Spheres.Radius[Index] * Spheres.Radius[Index];
+    }
+
+    //the chunk masks of ChunkTest against Reference for every shape, the bits past the partial last chunk must stay clear
+    template<typename TChunkTest, typename TReference>
+    bool ChunksMatch(TChunkTest ChunkTest, TReference Reference)
+    {
+        bool bMatches{true};
+        uint64 NumHits{0};
+
+        for(uint64 First{0}; First < NumShapes; First += 8)
+        {
+            int32 Expected{0};
+            for(uint64 Lane{0}; Lane < 8 && First + Lane < NumShapes; ++Lane)
+            {
+                Expected |= Reference(First + Lane) ? 1 << Lane : 0;
+            }
+
+            NumHits += Math::NumActiveBits(static_cast<uint32>(Expected));
+            bMatches = bMatches && ChunkTest(First) == Expected;
+        }
+
+        //the data has to produce both outcomes for the comparison to mean anything
+        return bMatches && NumHits > 0 && NumHits < NumShapes;
+    }
+
+    template<typename TReference>
+    bool IndicesMatch(const std::vector<uint32>& Indices, const uint64 NumVisible, TReference Reference)
+    {
+        std::vector<uint32> Expected;
+        for(uint32 Index{0}; Index < NumShapes; ++Index)
+        {
+            if(Reference(Index))
+            {
+                Expected.push_back(Index);
+            }
+        }
+
+        return NumVisible == Expected.size() && std::equal(Expected.begin(), Expected.end(), Indices.begin());
+    }
+}
+
+TEST(CullingFrustum)
+{
+    const FBoxes Boxes{1};
+    const FSpheres Spheres{2};
+
+    CHECK(ChunksMatch([&](const uint64 First){ return Culling::FrustumBoxes(Frustum, Boxes.View(), First); }, [&](const uint64 Index){ return FrustumBox(Boxes, Index); }));
+    CHECK(ChunksMatch([&](const uint64 First){ return Culling::FrustumSpheres(Frustum, Spheres.View(), First); }, [&](const uint64 Index){ return FrustumSphere(Spheres, Index); }));
+
+    //rounded up to whole chunks for the register stores
+    std::vector<uint32> Indices(NumShapes + 8);
+
+    const uint64 NumBoxes{Culling::CullBoxes(Frustum, Boxes.View(), Indices.data())};
+    CHECK(IndicesMatch(Indices, NumBoxes, [&](const uint64 Index){ return FrustumBox(Boxes, Index); }));
+
+    const uint64 NumSpheres{Culling::CullSpheres(Frustum, Spheres.View(), Indices.data())};
+    CHECK(IndicesMatch(Indices, NumSpheres, [&](const uint64 Index){ return FrustumSphere(Spheres, Index); }));
+}
+
+TEST(CullingRays)
+{
+    const FBoxes Boxes{3};
+    const FSpheres Spheres{4};
+
+    //reciprocals of the box ray directions are exact, the sphere ray directions have squared lengths that are powers of two
+    const FRay BoxRays[]
+    {
+        FRay{FVector4{-8.f, -2.f, 1.f}, FVector4{1.f, 0.5f, 0.25f}, 16.f},
+        FRay{FVector4{2.f, 6.f, -4.f}, FVector4{-0.25f, -1.f, 2.f}, 5.f},
+        FRay{FVector4{1.f, 1.f, 1.f}, FVector4{0.5f, -1.f, 0.25f}, 8.f},
+        FRay{FVector4{-8.f, -8.f, -8.f}, FVector4{1.f, 1.f, 1.f}, 16.f}
+    };
+    const FRay SphereRays[]
+    {
+        FRay{FVector4{-8.f, 0.f, 1.f}, FVector4{1.f, 0.f, 0.f}, 16.f},
+        FRay{FVector4{2.f, 6.f, -4.f}, FVector4{0.f, -1.f, 1.f}, 6.f},
+        FRay{FVector4{0.f, 0.f, 0.f}, FVector4{0.5f, 0.f, -0.5f}, 8.f}
+    };
+
+    bool bMatches{true};
+    for(const FRay& Ray : BoxRays)
+    {
+        bMatches = bMatches && ChunksMatch([&](const uint64 First){ return Culling::RayBoxes(Ray, Boxes.View(), First); }, [&](const uint64 Index){ return RayBox(Ray, Boxes, Index); });
+    }
+    for(const FRay& Ray : SphereRays)
+    {
+        bMatches = bMatches && ChunksMatch([&](const uint64 First){ return Culling::RaySpheres(Ray, Spheres.View(), First); }, [&](const uint64 Index){ return RaySphere(Ray, Spheres, Index); });
+    }
+    CHECK(bMatches);
+}
+
+TEST(CullingBoxes)
+{
+    const FBoxes Boxes{5};
+    const FSpheres Spheres{6};
+
+    const FVector4 Center{1.f, -2.f, 0.5f};
+    const FVector4 Extent{3.f, 2.5f, 4.f};
+
+    CHECK(ChunksMatch([&](const uint64 First){ return Culling::BoxBoxes(Center, Extent, Boxes.View(), First); }, [&](const uint64 Index){ return BoxBox(Center, Extent, Boxes, Index); }));
+    CHECK(ChunksMatch([&](const uint64 First){ return Culling::BoxSpheres(Center, Extent, Spheres.View(), First); }, [&](const uint64 Index){ return BoxSphere(Center, Extent, Spheres, Index); }));
+}
+
+TEST(CullingCompactIndices)
+{
+    bool bMatches{true};
+
+    for(int32 Mask{0}; Mask < 256; ++Mask)
+    {
+        uint32 Out[8];
+        const uint64 NumWritten{Culling::CompactIndices(Mask, 40, Out)};
+
+        uint64 Expected{0};
+        for(uint32 Bit{0}; Bit < 8; ++Bit)
+        {
+            if(Mask & (1 << Bit))
+            {
+                bMatches = bMatches && Out[Expected] == 40 + Bit;
+                ++Expected;
+            }
+        }
+        bMatches = bMatches && NumWritten == Expected;
+    }
+    CHECK(bMatches);
+}
@@ -0,0 +1,94 @@
+#include "Test.h"
+#include "../Divider.h"
+
+namespace
+{
+    //every lane of a few registers of dividends, including the extremes, against the scalar operators
+    template<typename TVector>
+    bool MatchesScalarDivision(const typename TVector::ElementType Divisor)
+    {
+        using ElementType = typename TVector::ElementType;
+
+        const Simd::TDivider<TVector> Divider{Divisor};
+
+        uint64 State{0x2545F4914F6CDD1Dull ^ static_cast<uint64>(Divisor)};
+
+        for(int32 Round{0}; Round < 64; ++Round)
+        {
+            TVector Dividends;
+            for(uint64 Lane{0}; Lane < TVector::NumElements; ++Lane)
+            {
+                State ^= State << 13;
+                State ^= State >> 7;
+                State ^= State << 17;
+                Dividends[Lane] = static_cast<ElementType>(State >> (State & 31));
+            }
+
+            if(Round == 0)
+            {
+                Dividends[0] = std::numeric_limits<ElementType>::max();
+                Dividends[1] = std::numeric_limits<ElementType>::min();
+                Dividends[2] = 0;
+            }
+
+            const TVector Quotients{Dividends / Divider};
+            const TVector Remainders{Dividends % Divider};
+
+            for(uint64 Lane{0}; Lane < TVector::NumElements; ++Lane)
+            {
+                //the lowest signed value divided by -1 wraps instead of trapping like the scalar division
+                if(std::is_signed_v<ElementType> && Divisor == static_cast<ElementType>(-1) && Dividends[Lane] == std::numeric_limits<ElementType>::min())
+                {
+                    continue;
+                }
+
+                if(Quotients[Lane] != static_cast<ElementType>(Dividends[Lane] / Divisor) || Remainders[Lane] != static_cast<ElementType>(Dividends[Lane] % Divisor))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    template<typename TVector>
+    bool MatchesScalarDivisions()
+    {
+        using ElementType = typename TVector::ElementType;
+
+        bool bMatches{true};
+
+        for(const int64 Divisor : {1ll, 2ll, 3ll, 7ll, 10ll, 64ll, 641ll, 1000ll, 32767ll})
+        {
+            bMatches = bMatches && MatchesScalarDivision<TVector>(static_cast<ElementType>(Divisor));
+
+            if constexpr(std::is_signed_v<ElementType>)
+            {
+                bMatches = bMatches && MatchesScalarDivision<TVector>(static_cast<ElementType>(-Divisor));
+            }
+        }
+
+        bMatches = bMatches && MatchesScalarDivision<TVector>(std::numeric_limits<ElementType>::max());
+
+        return bMatches;
+    }
+}
+
+TEST(Divider16BitLanes)
+{
+    CHECK(MatchesScalarDivisions<Simd::uint16_16>());
+    CHECK(MatchesScalarDivisions<Simd::int16_16>());
+}
+
+TEST(Divider32BitLanes)
+{
+    CHECK(MatchesScalarDivisions<Simd::uint32_8>());
+    CHECK(MatchesScalarDivisions<Simd::int32_8>());
+}
+
+TEST(Divider64BitLanes)
+{
+    CHECK(MatchesScalarDivisions<Simd::uint64_4>());
+    CHECK(MatchesScalarDivisions<Simd::int64_4>());
+}
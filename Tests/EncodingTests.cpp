@@ -0,0 +1,91 @@
+#include "Test.h"
+#include "../Encoding.h"
+#include "../String.h"
+
+namespace
+{
+    bool EncodesTo(const char8* Input, const char8* Expected, const StringUtility::EBase64Alphabet Alphabet)
+    {
+        const uint64 NumBytes{StringUtility::Length(Input)};
+        const uint64 ExpectedSize{StringUtility::Length(Expected)};
+
+        char8 Encoded[256];
+        const uint64 NumCharacters{StringUtility::Base64Encode(reinterpret_cast<const uint8*>(Input), NumBytes, Encoded, Alphabet)};
+
+        uint8 Decoded[256];
+        const StringUtility::FDecodeResult Result{StringUtility::Base64Decode(Encoded, NumCharacters, Decoded, Alphabet)};
+
+        return NumCharacters == ExpectedSize && NumCharacters == StringUtility::Base64EncodedSize(NumBytes, Alphabet) && __builtin_memcmp(Encoded, Expected, ExpectedSize) == 0
+            && Result.IsValid() && Result.NumBytes == NumBytes && __builtin_memcmp(Decoded, Input, NumBytes) == 0;
+    }
+}
+
+//RFC 4648 section 10
+TEST(Base64Vectors)
+{
+    CHECK(EncodesTo("", "", StringUtility::EBase64Alphabet::Standard));
+    CHECK(EncodesTo("f", "Zg==", StringUtility::EBase64Alphabet::Standard));
+    CHECK(EncodesTo("fo", "Zm8=", StringUtility::EBase64Alphabet::Standard));
+    CHECK(EncodesTo("foo", "Zm9v", StringUtility::EBase64Alphabet::Standard));
+    CHECK(EncodesTo("foob", "Zm9vYg==", StringUtility::EBase64Alphabet::Standard));
+    CHECK(EncodesTo("fooba", "Zm9vYmE=", StringUtility::EBase64Alphabet::Standard));
+    CHECK(EncodesTo("foobar", "Zm9vYmFy", StringUtility::EBase64Alphabet::Standard));
+    CHECK(EncodesTo("foob", "Zm9vYg", StringUtility::EBase64Alphabet::UrlSafe));
+}
+
+//long enough to run through the vector blocks and the scalar tail
+TEST(Base64RoundTrip)
+{
+    uint8 Data[1000];
+    for(uint64 Index{0}; Index < sizeof(Data); ++Index)
+    {
+        Data[Index] = static_cast<uint8>(Index * 131 + (Index >> 3));
+    }
+
+    for(const StringUtility::EBase64Alphabet Alphabet : {StringUtility::EBase64Alphabet::Standard, StringUtility::EBase64Alphabet::UrlSafe})
+    {
+        for(const uint64 NumBytes : {31ull, 48ull, 100ull, 999ull, 1000ull})
+        {
+            char8 Encoded[1400];
+            const uint64 NumCharacters{StringUtility::Base64Encode(Data, NumBytes, Encoded, Alphabet)};
+
+            uint8 Decoded[1000];
+            const StringUtility::FDecodeResult Result{StringUtility::Base64Decode(Encoded, NumCharacters, Decoded, Alphabet)};
+
+            CHECK(Result.IsValid() && Result.NumBytes == NumBytes && __builtin_memcmp(Decoded, Data, NumBytes) == 0);
+        }
+    }
+}
+
+TEST(Base64Errors)
+{
+    char8 Text[80];
+    __builtin_memset(Text, 'A', sizeof(Text));
+    Text[45] = '*';
+
+    uint8 Decoded[80];
+    const StringUtility::FDecodeResult Result{StringUtility::Base64Decode(Text, sizeof(Text), Decoded, StringUtility::EBase64Alphabet::Standard)};
+
+    CHECK(!Result.IsValid());
+    CHECK(Result.ErrorPosition == 45);
+}
+
+TEST(Hex)
+{
+    const uint8 Data[5]{0x00, 0x1F, 0xA0, 0xFF, 0x7B};
+
+    char8 Lower[10];
+    StringUtility::HexEncode(Data, sizeof(Data), Lower);
+    CHECK(__builtin_memcmp(Lower, "001fa0ff7b", 10) == 0);
+
+    char8 Upper[10];
+    StringUtility::HexEncode(Data, sizeof(Data), Upper, true);
+    CHECK(__builtin_memcmp(Upper, "001FA0FF7B", 10) == 0);
+
+    uint8 Decoded[5];
+    const StringUtility::FDecodeResult Result{StringUtility::HexDecode("001fA0Ff7b", 10, Decoded)};
+    CHECK(Result.IsValid() && Result.NumBytes == 5 && __builtin_memcmp(Decoded, Data, 5) == 0);
+
+    CHECK(StringUtility::HexDecode("0g", 2, Decoded).ErrorPosition == 1);
+    CHECK(StringUtility::HexDecode("abc", 3, Decoded).ErrorPosition == 2);
+}
@@ -0,0 +1,124 @@
+#include "Test.h"
+#include "../HalfFloat.h"
+
+#include <bit>
+
+namespace
+{
+    //sizes around the two chunk loop, the single chunk loop and the padded tail
+    constexpr uint64 Sizes[]{0, 1, 7, 8, 9, 16, 17, 31, 32, 33, 100};
+    constexpr uint64 MaxSize{100};
+
+    void Fill(float32* Data, const uint64 Num, const float32 Scale)
+    {
+        //small integers times a power of two, exact in both half types
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            Data[Index] = (static_cast<float32>(Index % 13) - 6.f) * Scale;
+        }
+    }
+
+    float32 ReferenceDot(const float32* LHS, const float32* RHS, const uint64 Num)
+    {
+        float64 Sum{0.0};
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            Sum += static_cast<float64>(LHS[Index]) * static_cast<float64>(RHS[Index]);
+        }
+
+        return static_cast<float32>(Sum);
+    }
+
+    uint16 BFloat16Bits(const uint32 Float32Bits)
+    {
+        const float32 Source[1]{std::bit_cast<float32>(Float32Bits)};
+        bfloat16 Out[1];
+        HalfFloat::ConvertToBFloat16(Source, 1, Out);
+
+        return std::bit_cast<uint16>(Out[0]);
+    }
+}
+
+TEST(HalfFloatRoundTrip)
+{
+    float32 Source[MaxSize];
+    Fill(Source, MaxSize, 0.25f);
+
+    for(const uint64 Num : Sizes)
+    {
+        //the guards past the end catch any store outside the tail
+        float16 Half[MaxSize + 1];
+        bfloat16 BHalf[MaxSize + 1];
+        float32 Out[MaxSize + 1];
+        float32 BOut[MaxSize + 1];
+        Half[Num] = static_cast<float16>(12345.f);
+        BHalf[Num] = static_cast<bfloat16>(-7.f);
+        Out[Num] = 12345.f;
+        BOut[Num] = 12345.f;
+
+        HalfFloat::ConvertToFloat16(Source, Num, Half);
+        HalfFloat::ConvertToBFloat16(Source, Num, BHalf);
+        HalfFloat::ConvertToFloat32(Half, Num, Out);
+        HalfFloat::ConvertToFloat32(BHalf, Num, BOut);
+
+        bool bMatches{static_cast<float32>(Half[Num]) == 12345.f && static_cast<float32>(BHalf[Num]) == -7.f && Out[Num] == 12345.f && BOut[Num] == 12345.f};
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            bMatches = bMatches && Out[Index] == Source[Index] && BOut[Index] == Source[Index] && static_cast<float32>(Half[Index]) == Source[Index];
+        }
+        CHECK(bMatches);
+    }
+}
+
+TEST(HalfFloatRounding)
+{
+    //ties go to the even bfloat16, anything above a tie rounds up
+    CHECK(BFloat16Bits(0x3F800000u) == 0x3F80);
+    CHECK(BFloat16Bits(0x3F808000u) == 0x3F80);
+    CHECK(BFloat16Bits(0x3F818000u) == 0x3F82);
+    CHECK(BFloat16Bits(0x3F808001u) == 0x3F81);
+    CHECK(BFloat16Bits(0xBF808001u) == 0xBF81);
+
+    //the largest finite float rounds up to infinity, NaNs stay NaNs even when their payload sits in the dropped bits
+    CHECK(BFloat16Bits(0x7F7FFFFFu) == 0x7F80);
+    CHECK(BFloat16Bits(0x7F800000u) == 0x7F80);
+    CHECK(BFloat16Bits(0x7F800001u) == 0x7FC0);
+    CHECK(BFloat16Bits(0xFFFFFFFFu) == 0xFFFF);
+
+    const float32 Source[4]{65504.f, 65520.f, 1.f + 1.f / 2048.f, 1.f + 3.f / 2048.f};
+    float16 Half[4];
+    HalfFloat::ConvertToFloat16(Source, 4, Half);
+
+    CHECK(std::bit_cast<uint16>(Half[0]) == 0x7BFF);
+    CHECK(std::bit_cast<uint16>(Half[1]) == 0x7C00);
+    CHECK(std::bit_cast<uint16>(Half[2]) == 0x3C00);
+    CHECK(std::bit_cast<uint16>(Half[3]) == 0x3C02);
+}
+
+TEST(HalfFloatDot)
+{
+    float32 A[MaxSize];
+    float32 B[MaxSize];
+    Fill(A, MaxSize, 0.5f);
+    Fill(B, MaxSize, -0.125f);
+
+    float16 HalfA[MaxSize];
+    float16 HalfB[MaxSize];
+    bfloat16 BHalfA[MaxSize];
+    bfloat16 BHalfB[MaxSize];
+    HalfFloat::ConvertToFloat16(A, MaxSize, HalfA);
+    HalfFloat::ConvertToFloat16(B, MaxSize, HalfB);
+    HalfFloat::ConvertToBFloat16(A, MaxSize, BHalfA);
+    HalfFloat::ConvertToBFloat16(B, MaxSize, BHalfB);
+
+    //the products and their sums are exact in float32, so every order of the additions gives the same result
+    for(const uint64 Num : Sizes)
+    {
+        const float32 Expected{ReferenceDot(A, B, Num)};
+
+        CHECK(HalfFloat::Dot(HalfA, HalfB, Num) == Expected);
+        CHECK(HalfFloat::Dot(BHalfA, BHalfB, Num) == Expected);
+        CHECK(HalfFloat::Dot(HalfA, B, Num) == Expected);
+        CHECK(HalfFloat::Dot(BHalfA, B, Num) == Expected);
+    }
+}
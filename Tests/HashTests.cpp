@@ -0,0 +1,56 @@
+#include "Test.h"
+#include "../Hash.h"
+
+TEST(Crc32CCheckValue)
+{
+    CHECK(Simd::Crc32C("123456789", 9) == 0xE3069283);
+    CHECK(Simd::Crc32C("", 0) == 0);
+}
+
+//the interleaved streams and their recombination must agree with feeding the same bytes in pieces
+TEST(Crc32CLongInput)
+{
+    static uint8 Data[20000];
+    for(uint64 Index{0}; Index < sizeof(Data); ++Index)
+    {
+        Data[Index] = static_cast<uint8>(Index * 7 + (Index >> 8));
+    }
+
+    for(const uint64 Size : {255ull, 768ull, 8191ull, 8192ull, 20000ull})
+    {
+        uint32 Piecewise{0};
+        for(uint64 Offset{0}; Offset < Size; Offset += 100)
+        {
+            Piecewise = Simd::Crc32C(Data + Offset, Size - Offset < 100 ? Size - Offset : 100, Piecewise);
+        }
+
+        CHECK(Simd::Crc32C(Data, Size) == Piecewise);
+    }
+}
+
+TEST(Hash64Batched)
+{
+    static uint8 Data[300];
+    for(uint64 Index{0}; Index < sizeof(Data); ++Index)
+    {
+        Data[Index] = static_cast<uint8>(Index * 13);
+    }
+
+    const uint64 Sizes[9]{0, 1, 3, 8, 16, 17, 32, 33, 300};
+    const void* Keys[9];
+    for(const void*& Key : Keys)
+    {
+        Key = Data;
+    }
+
+    uint64 Hashes[9];
+    Simd::Hash64(Keys, Sizes, 9, Hashes, 5);
+
+    for(uint64 Index{0}; Index < 9; ++Index)
+    {
+        CHECK(Hashes[Index] == Simd::Hash64(Data, Sizes[Index], 5));
+    }
+
+    CHECK(Simd::Hash64(Data, 32) != Simd::Hash64(Data, 33));
+    CHECK(Simd::Hash64(Data, 32, 0) != Simd::Hash64(Data, 32, 1));
+}
@@ -0,0 +1,91 @@
+#include "Test.h"
+#include "../Histogram.h"
+
+#include <vector>
+
+namespace
+{
+    //sizes around a register and the sub table lanes, and past the 255 block fold of HistogramSmall
+    constexpr uint64 Sizes[]{0, 1, 31, 32, 33, 1000, 255 * 32 + 40};
+    constexpr uint64 MaxSize{255 * 32 + 40};
+
+    uint64 NextValue(uint64& State)
+    {
+        State ^= State << 13;
+        State ^= State >> 7;
+        State ^= State << 17;
+        return State;
+    }
+
+    template<typename TKey>
+    bool BucketsMatch(const std::vector<TKey>& Keys, const uint64 Num, const uint32 Shift, const uint32 NumBits)
+    {
+        std::vector<uint64> Expected(1ull << NumBits);
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            ++Expected[(Keys[Index] >> Shift) & ((1u << NumBits) - 1)];
+        }
+
+        //the output is filled with garbage first, the histogram has to overwrite all of it
+        std::vector<uint64> Out(1ull << NumBits, 77);
+        Simd::Histogram(Keys.data(), Num, Shift, NumBits, Out.data());
+
+        return Out == Expected;
+    }
+}
+
+TEST(HistogramBytes)
+{
+    std::vector<uint8> Data(MaxSize);
+    uint64 State{0x9E3779B97F4A7C15};
+    for(uint8& Byte : Data)
+    {
+        //mostly small values so HistogramSmall has something to count
+        Byte = static_cast<uint8>(NextValue(State) % 4 == 0 ? NextValue(State) : NextValue(State) % 12);
+    }
+
+    bool bMatches{true};
+    for(const uint64 Num : Sizes)
+    {
+        uint64 Expected[256]{};
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            ++Expected[Data[Index]];
+        }
+
+        uint64 Out[256];
+        Memory::Set(Out, 0xFF, sizeof(Out));
+        Simd::Histogram(Data.data(), Num, Out);
+
+        uint64 Small[12];
+        Memory::Set(Small, 0xFF, sizeof(Small));
+        Simd::HistogramSmall(Data.data(), Num, Small);
+
+        for(uint64 Value{0}; Value < 256; ++Value)
+        {
+            bMatches = bMatches && Out[Value] == Expected[Value] && (Value >= 12 || Small[Value] == Expected[Value]);
+        }
+    }
+    CHECK(bMatches);
+}
+
+TEST(HistogramBuckets)
+{
+    std::vector<uint16> Keys16(MaxSize);
+    std::vector<uint32> Keys32(MaxSize);
+    uint64 State{0xD1B54A32D192ED03};
+    for(uint64 Index{0}; Index < MaxSize; ++Index)
+    {
+        Keys16[Index] = static_cast<uint16>(NextValue(State));
+        Keys32[Index] = static_cast<uint32>(NextValue(State));
+    }
+
+    //bucket counts that use the sub tables and ones too large for them
+    bool bMatches{true};
+    for(const uint64 Num : Sizes)
+    {
+        bMatches = bMatches && BucketsMatch(Keys16, Num, 0, 8) && BucketsMatch(Keys16, Num, 8, 8) && BucketsMatch(Keys16, Num, 3, 12);
+        bMatches = bMatches && BucketsMatch(Keys32, Num, 0, 11) && BucketsMatch(Keys32, Num, 24, 8) && BucketsMatch(Keys32, Num, 5, 16);
+    }
+    CHECK(bMatches);
+}
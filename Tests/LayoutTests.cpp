@@ -0,0 +1,144 @@
+#include "Test.h"
+#include "../Layout.h"
+
+#include <vector>
+
+namespace
+{
+    //sizes around one register of structs, for 8 bit lanes that is 32 structs
+    constexpr uint64 Sizes[]{0, 1, 5, 8, 9, 16, 31, 32, 33, 64, 100};
+
+    template<uint64 NumFields, typename T>
+    bool RoundTripMatches(const uint64 Num)
+    {
+        std::vector<T> Structs(Num * NumFields + 1);
+        for(uint64 Index{0}; Index < Structs.size(); ++Index)
+        {
+            Structs[Index] = static_cast<T>(Index * 7 + 3);
+        }
+
+        //the guards past the end catch any store outside the tail
+        std::vector<T> Storage[NumFields];
+        T* Fields[NumFields];
+        for(uint64 Field{0}; Field < NumFields; ++Field)
+        {
+            Storage[Field].assign(Num + 1, static_cast<T>(99));
+            Fields[Field] = Storage[Field].data();
+        }
+
+        Layout::Deinterleave<NumFields>(Structs.data(), Num, Fields);
+
+        bool bMatches{true};
+        for(uint64 Field{0}; Field < NumFields; ++Field)
+        {
+            bMatches = bMatches && Storage[Field][Num] == static_cast<T>(99);
+            for(uint64 Index{0}; Index < Num; ++Index)
+            {
+                bMatches = bMatches && Fields[Field][Index] == Structs[Index * NumFields + Field];
+            }
+        }
+
+        std::vector<T> Out(Num * NumFields + 1, static_cast<T>(99));
+        const T* ConstFields[NumFields];
+        for(uint64 Field{0}; Field < NumFields; ++Field)
+        {
+            ConstFields[Field] = Fields[Field];
+        }
+
+        Layout::Interleave<NumFields>(ConstFields, Num, Out.data());
+
+        Structs.back() = static_cast<T>(99);
+        return bMatches && Out == Structs;
+    }
+
+    template<typename T>
+    bool AllRoundTripsMatch()
+    {
+        bool bMatches{true};
+        for(const uint64 Num : Sizes)
+        {
+            bMatches = bMatches && RoundTripMatches<2, T>(Num) && RoundTripMatches<3, T>(Num) && RoundTripMatches<4, T>(Num);
+        }
+
+        return bMatches;
+    }
+}
+
+TEST(LayoutTranspose)
+{
+    Simd::float32_8 Rows[8];
+    for(uint64 Row{0}; Row < 8; ++Row)
+    {
+        for(uint64 Column{0}; Column < 8; ++Column)
+        {
+            Rows[Row][Column] = static_cast<float32>(Row * 8 + Column);
+        }
+    }
+
+    Simd::Transpose8x8(Rows);
+
+    bool bMatches{true};
+    for(uint64 Row{0}; Row < 8; ++Row)
+    {
+        for(uint64 Column{0}; Column < 8; ++Column)
+        {
+            bMatches = bMatches && Rows[Row][Column] == static_cast<float32>(Column * 8 + Row);
+        }
+    }
+    CHECK(bMatches);
+
+    Simd::int32_4 Small[4]{Simd::int32_4{0, 1, 2, 3}, Simd::int32_4{4, 5, 6, 7}, Simd::int32_4{8, 9, 10, 11}, Simd::int32_4{12, 13, 14, 15}};
+    Simd::Transpose4x4(Small);
+
+    CHECK((Small[0] == Simd::int32_4{0, 4, 8, 12}).All());
+    CHECK((Small[1] == Simd::int32_4{1, 5, 9, 13}).All());
+    CHECK((Small[3] == Simd::int32_4{3, 7, 11, 15}).All());
+
+    //with 8 lanes the halves are separate matrices, the upper one is offset by 100
+    Simd::int32_8 Halves[4];
+    for(int32 Row{0}; Row < 4; ++Row)
+    {
+        for(int32 Column{0}; Column < 4; ++Column)
+        {
+            Halves[Row][Column] = Row * 4 + Column;
+            Halves[Row][Column + 4] = Row * 4 + Column + 100;
+        }
+    }
+
+    Simd::Transpose4x4(Halves);
+
+    CHECK((Halves[0] == Simd::int32_8{0, 4, 8, 12, 100, 104, 108, 112}).All());
+    CHECK((Halves[2] == Simd::int32_8{2, 6, 10, 14, 102, 106, 110, 114}).All());
+}
+
+TEST(LayoutInterleaveRegisters)
+{
+    //xyz of 16 structs in 16 bit lanes
+    Simd::uint16_16 Structs[3];
+    for(uint16 Index{0}; Index < 48; ++Index)
+    {
+        Structs[Index / 16][Index % 16] = Index;
+    }
+
+    Simd::uint16_16 Fields[3];
+    Simd::Deinterleave(Structs, Fields);
+
+    bool bMatches{true};
+    for(uint16 Index{0}; Index < 16; ++Index)
+    {
+        bMatches = bMatches && Fields[0][Index] == Index * 3 && Fields[1][Index] == Index * 3 + 1 && Fields[2][Index] == Index * 3 + 2;
+    }
+    CHECK(bMatches);
+
+    Simd::uint16_16 Back[3];
+    Simd::Interleave(Fields, Back);
+
+    CHECK((Back[0] == Structs[0]).All() && (Back[1] == Structs[1]).All() && (Back[2] == Structs[2]).All());
+}
+
+TEST(LayoutSpans)
+{
+    CHECK(AllRoundTripsMatch<uint8>());
+    CHECK(AllRoundTripsMatch<int16>());
+    CHECK(AllRoundTripsMatch<float32>());
+}
@@ -0,0 +1,159 @@
+#include "Test.h"
+#include "../LinearAlgebra.h"
+
+#include <vector>
+
+namespace
+{
+    //small integers keep every product and sum exact in float32, so any order of the additions gives the reference result
+    template<typename T>
+    void Fill(T* Data, const uint64 Num, const uint64 Seed)
+    {
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            Data[Index] = static_cast<T>(static_cast<int64>((Index * 5 + Seed * 3) % 7) - 3);
+        }
+    }
+
+    //LHS.NumRows x RHS.NumColumns written with RowStride Stride, Out holds what is added to when bAccumulate is set
+    bool MultiplyMatches(const uint64 NumRows, const uint64 NumDepth, const uint64 NumColumns, const uint64 Stride, const bool bAccumulate)
+    {
+        std::vector<float32> LHS(NumRows * NumDepth + 1);
+        std::vector<float32> RHS(NumDepth * NumColumns + 1);
+        std::vector<float32> Out(NumRows * Stride + 1);
+        std::vector<float32> Expected(Out.size());
+        Fill(LHS.data(), LHS.size(), 1);
+        Fill(RHS.data(), RHS.size(), 2);
+        Fill(Out.data(), Out.size(), 3);
+        Expected = Out;
+
+        for(uint64 Row{0}; Row < NumRows; ++Row)
+        {
+            for(uint64 Column{0}; Column < NumColumns; ++Column)
+            {
+                float32 Sum{bAccumulate ? Expected[Row * Stride + Column] : 0.f};
+                for(uint64 Depth{0}; Depth < NumDepth; ++Depth)
+                {
+                    Sum += LHS[Row * NumDepth + Depth] * RHS[Depth * NumColumns + Column];
+                }
+
+                Expected[Row * Stride + Column] = Sum;
+            }
+        }
+
+        LinearAlgebra::Multiply(FConstMatrixView{LHS.data(), NumRows, NumDepth, NumDepth}, FConstMatrixView{RHS.data(), NumDepth, NumColumns, NumColumns},
+            FMatrixView{Out.data(), NumRows, NumColumns, Stride}, bAccumulate);
+
+        //the padding between rows and the element past the end must be left alone
+        return Out == Expected;
+    }
+}
+
+TEST(LinearAlgebraDotAxpy)
+{
+    constexpr uint64 Sizes[]{0, 1, 3, 8, 9, 31, 32, 33, 100};
+
+    float32 A[100];
+    float32 B[100];
+    float64 C[100];
+    float64 D[100];
+    Fill(A, 100, 1);
+    Fill(B, 100, 2);
+    Fill(C, 100, 3);
+    Fill(D, 100, 4);
+
+    for(const uint64 Num : Sizes)
+    {
+        float32 Expected{0.f};
+        float64 Expected64{0.0};
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            Expected += A[Index] * B[Index];
+            Expected64 += C[Index] * D[Index];
+        }
+
+        CHECK(LinearAlgebra::Dot(A, B, Num) == Expected);
+        CHECK(LinearAlgebra::Dot(C, D, Num) == Expected64);
+
+        float32 Y[101];
+        float64 Y64[101];
+        Memory::Copy(Y, B, sizeof(B));
+        Memory::Copy(Y64, D, sizeof(D));
+        Y[Num] = 12345.f;
+        Y64[Num] = 12345.0;
+
+        LinearAlgebra::Axpy(-2.f, A, Num, Y);
+        LinearAlgebra::Axpy(0.5, C, Num, Y64);
+
+        bool bMatches{Y[Num] == 12345.f && Y64[Num] == 12345.0};
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            bMatches = bMatches && Y[Index] == B[Index] - 2.f * A[Index] && Y64[Index] == D[Index] + 0.5 * C[Index];
+        }
+        CHECK(bMatches);
+    }
+}
+
+TEST(LinearAlgebraCosineSimilarity)
+{
+    constexpr uint64 Dimension{19};
+    constexpr uint64 Stride{24};
+    constexpr uint64 NumVectors{7};
+
+    float32 Query[Dimension];
+    float32 Vectors[NumVectors * Stride]{};
+    Fill(Query, Dimension, 5);
+
+    for(uint64 Row{0}; Row < NumVectors; ++Row)
+    {
+        Fill(Vectors + Row * Stride, Dimension, Row);
+    }
+
+    //a scaled copy of the query, its negation and a zero vector
+    for(uint64 Index{0}; Index < Dimension; ++Index)
+    {
+        Vectors[Index] = Query[Index] * 3.f;
+        Vectors[Stride + Index] = -Query[Index];
+        Vectors[6 * Stride + Index] = 0.f;
+    }
+
+    float32 Out[NumVectors];
+    LinearAlgebra::CosineSimilarity(Query, FConstMatrixView{Vectors, NumVectors, Dimension, Stride}, Out);
+
+    CHECK(__builtin_fabsf(Out[0] - 1.f) <= 1e-6f);
+    CHECK(__builtin_fabsf(Out[1] + 1.f) <= 1e-6f);
+    CHECK(Out[6] == 0.f);
+
+    bool bMatches{true};
+    for(uint64 Row{2}; Row < 6; ++Row)
+    {
+        const float32* Vector{Vectors + Row * Stride};
+        float64 Product{0.0};
+        float64 Length{0.0};
+        float64 QueryLength{0.0};
+        for(uint64 Index{0}; Index < Dimension; ++Index)
+        {
+            Product += Query[Index] * Vector[Index];
+            Length += Vector[Index] * Vector[Index];
+            QueryLength += Query[Index] * Query[Index];
+        }
+
+        bMatches = bMatches && __builtin_fabs(Out[Row] - Product / __builtin_sqrt(Length * QueryLength)) <= 1e-6;
+    }
+    CHECK(bMatches);
+}
+
+TEST(LinearAlgebraMultiply)
+{
+    //full and partial tiles, more depth than one packed block and more rows than one LHS block
+    CHECK(MultiplyMatches(1, 1, 1, 1, false));
+    CHECK(MultiplyMatches(6, 8, 16, 16, false));
+    CHECK(MultiplyMatches(7, 5, 17, 20, false));
+    CHECK(MultiplyMatches(13, 300, 33, 40, false));
+    CHECK(MultiplyMatches(150, 10, 48, 48, false));
+    CHECK(MultiplyMatches(64, 64, 64, 64, false));
+    CHECK(MultiplyMatches(64, 64, 64, 70, true));
+    CHECK(MultiplyMatches(13, 300, 33, 40, true));
+    CHECK(MultiplyMatches(5, 0, 9, 9, false));
+    CHECK(MultiplyMatches(5, 0, 9, 9, true));
+}
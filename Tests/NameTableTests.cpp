@@ -0,0 +1,97 @@
+#include "Test.h"
+#include "../NameTable.h"
+
+#include <cstdio>
+#include <thread>
+
+namespace
+{
+    FStaticString MakeName(const uint32 Index)
+    {
+        char8 Buffer[32];
+        std::snprintf(Buffer, sizeof(Buffer), "Identifier_%u", Index);
+        return FStaticString::MakeFromRaw(Buffer);
+    }
+}
+
+TEST(NameTableIntern)
+{
+    FNameTable Table{1000};
+
+    const FName Open{Table.Intern(FStaticString{"Open"})};
+    const FName Close{Table.Intern(FStaticString{"Close"})};
+
+    CHECK(!Open.IsNone() && !Close.IsNone());
+    CHECK(Open != Close);
+    CHECK(Table.Intern(FStaticString{"Open"}) == Open);
+    CHECK(Table.Find(FStaticString{"Close"}) == Close);
+    CHECK(Table.Find(FStaticString{"Seek"}).IsNone());
+
+    CHECK(Table.Resolve(Open) == "Open");
+    CHECK(Table.Resolve(FName{}) == "");
+    CHECK(Table.Intern(FStaticString{}).IsNone());
+    CHECK(Table.Intern(FStaticString{""}).IsNone());
+    CHECK(Table.Find(FStaticString{}).IsNone());
+    CHECK(reinterpret_cast<uint64>(&Table.Resolve(Close)) % 32 == 0);
+    CHECK(Table.Num() == 2);
+}
+
+TEST(NameTableFull)
+{
+    FNameTable Table{10};
+
+    uint32 NumInterned{0};
+    for(uint32 Index{0}; Index < 20; ++Index)
+    {
+        NumInterned += !Table.Intern(MakeName(Index)).IsNone();
+    }
+
+    CHECK(NumInterned == 10);
+    CHECK(Table.Num() == 10);
+}
+
+//every thread interns the same names in a different order, all of them have to agree on every handle
+TEST(NameTableConcurrent)
+{
+    constexpr uint32 NumThreads{4};
+    constexpr uint32 NumNames{20000};
+
+    FNameTable Table{NumNames * 2};
+
+    FName* Handles{new FName[NumThreads * NumNames]};
+
+    std::thread Threads[NumThreads];
+    for(uint32 Thread{0}; Thread < NumThreads; ++Thread)
+    {
+        Threads[Thread] = std::thread{[&Table, Handles, Thread]()
+        {
+            for(uint32 Step{0}; Step < NumNames; ++Step)
+            {
+                const uint32 Index{(Step * 7919 + Thread * 5003) % NumNames};
+                Handles[Thread * NumNames + Index] = Table.Intern(MakeName(Index));
+            }
+        }};
+    }
+
+    for(std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+
+    bool bAgree{true};
+    for(uint32 Index{0}; Index < NumNames; ++Index)
+    {
+        const FName Name{Handles[Index]};
+        bAgree = bAgree && !Name.IsNone() && Table.Resolve(Name) == MakeName(Index) && Table.Find(MakeName(Index)) == Name;
+
+        for(uint32 Thread{1}; Thread < NumThreads; ++Thread)
+        {
+            bAgree = bAgree && Handles[Thread * NumNames + Index] == Name;
+        }
+    }
+
+    CHECK(bAgree);
+    CHECK(Table.Num() >= NumNames);
+
+    delete[] Handles;
+}
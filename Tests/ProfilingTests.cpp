@@ -0,0 +1,61 @@
+#include "Test.h"
+#include "../Profiling.h"
+
+namespace
+{
+    const Profiling::FKernelStats* FindKernel(const Profiling::FKernelStats* Stats, const uint64 NumStats, const char8* Name)
+    {
+        for(uint64 Index{0}; Index < NumStats; ++Index)
+        {
+            if(Stats[Index].Name == Name)
+            {
+                return &Stats[Index];
+            }
+        }
+        return nullptr;
+    }
+}
+
+//uses FScope directly so the test runs whether or not PROFILE_SCOPE is compiled in
+TEST(ProfilingScopes)
+{
+    static constexpr char8 Name[]{"ProfilingScopes"};
+    static const Profiling::FKernel Kernel{Name};
+
+    //counters are optional, containers usually refuse them
+    const bool bCounters{Profiling::EnableCounters()};
+
+    volatile uint64 Sum{0};
+    for(int32 Call{0}; Call < 100; ++Call)
+    {
+        const Profiling::FScope Scope{Kernel};
+
+        for(int32 Index{0}; Index < 1000; ++Index)
+        {
+            Sum = Sum + Index;
+        }
+    }
+
+    Profiling::DisableCounters();
+
+    static Profiling::FKernelStats Stats[Profiling::MaxKernels];
+    const uint64 NumStats{Profiling::Snapshot(Stats, Profiling::MaxKernels)};
+
+    const Profiling::FKernelStats* KernelStats{FindKernel(Stats, NumStats, Name)};
+    CHECK(KernelStats != nullptr);
+
+    if(KernelStats != nullptr)
+    {
+        uint64 NumBucketed{0};
+        for(const uint64 Count : KernelStats->Buckets)
+        {
+            NumBucketed += Count;
+        }
+
+        CHECK(KernelStats->NumCalls == 100);
+        CHECK(NumBucketed == 100);
+        CHECK(KernelStats->MinTicks > 0 && KernelStats->MinTicks <= KernelStats->MaxTicks);
+        CHECK(KernelStats->PercentileTicks(0.5) >= KernelStats->MinTicks);
+        CHECK(KernelStats->NumCountedCalls == (bCounters ? 100 : 0));
+    }
+}
@@ -0,0 +1,243 @@
+#include "Test.h"
+#include "../Random.h"
+
+namespace
+{
+    //the scalar xoshiro256** and SplitMix64 from the reference implementation, one stream at a time
+    struct FReference final
+    {
+        uint64 Next()
+        {
+            const uint64 Result{RotateLeft(State[1] * 5, 7) * 9};
+            const uint64 Shifted{State[1] << 17};
+
+            State[2] ^= State[0];
+            State[3] ^= State[1];
+            State[1] ^= State[2];
+            State[0] ^= State[3];
+            State[2] ^= Shifted;
+            State[3] = RotateLeft(State[3], 45);
+
+            return Result;
+        }
+
+        void Jump(const uint64 (&Polynomial)[4])
+        {
+            uint64 Jumped[4]{};
+            for(const uint64 Coefficients : Polynomial)
+            {
+                for(int32 Bit{0}; Bit < 64; ++Bit)
+                {
+                    if(Coefficients & (1ull << Bit))
+                    {
+                        for(int32 Word{0}; Word < 4; ++Word)
+                        {
+                            Jumped[Word] ^= State[Word];
+                        }
+                    }
+                    Next();
+                }
+            }
+
+            for(int32 Word{0}; Word < 4; ++Word)
+            {
+                State[Word] = Jumped[Word];
+            }
+        }
+
+        static uint64 RotateLeft(const uint64 Value, const int32 Amount)
+        {
+            return (Value << Amount) | (Value >> (64 - Amount));
+        }
+
+        uint64 State[4];
+    };
+
+    constexpr uint64 JumpPolynomial[4]{0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C};
+    constexpr uint64 LongJumpPolynomial[4]{0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635};
+
+    constexpr uint64 Seed{42};
+
+    //lane N of FRandom{Seed} is the SplitMix64 seeded stream jumped N times
+    void MakeLanes(FReference (&Lanes)[4])
+    {
+        uint64 SeedState{Seed};
+        for(uint64& Word : Lanes[0].State)
+        {
+            uint64 Value{SeedState += 0x9E3779B97F4A7C15};
+            Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9;
+            Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EB;
+            Word = Value ^ (Value >> 31);
+        }
+
+        for(int32 Lane{1}; Lane < 4; ++Lane)
+        {
+            Lanes[Lane] = Lanes[Lane - 1];
+            Lanes[Lane].Jump(JumpPolynomial);
+        }
+    }
+
+    bool MatchesLanes(Simd::FRandom& Random, FReference (&Lanes)[4], const int32 NumSteps)
+    {
+        bool bMatches{true};
+        for(int32 Step{0}; Step < NumSteps; ++Step)
+        {
+            const Simd::uint64_4 Values{Random.Next()};
+            for(int32 Lane{0}; Lane < 4; ++Lane)
+            {
+                bMatches = bMatches && Values[Lane] == Lanes[Lane].Next();
+            }
+        }
+        return bMatches;
+    }
+}
+
+TEST(RandomReference)
+{
+    //the published first outputs of xoshiro256** from the state {1, 2, 3, 4}
+    FReference Reference{{1, 2, 3, 4}};
+    CHECK(Reference.Next() == 11520);
+    CHECK(Reference.Next() == 0);
+    CHECK(Reference.Next() == 1509978240);
+    CHECK(Reference.Next() == 1215971899390074240);
+}
+
+TEST(RandomStreams)
+{
+    //the first outputs of every stream of seed 42, lane N is N jumps ahead of lane 0
+    constexpr uint64 KnownAnswers[4][3]
+    {
+        {0x15780B2E0C2EC716, 0x6104D9866D113A7E, 0xAE17533239E499A1},
+        {0x50086EF83CBF4F4A, 0xBA285EC21347D703, 0x5EA1247B4DC6452A},
+        {0x8677623EE7544E81, 0x1F591F213A3CB979, 0xBEE76BE78F4BFE6D},
+        {0x057EA7493B2592A3, 0xD24B173F5C5CDD42, 0x94BB1464B9EEB5FB}
+    };
+
+    bool bMatches{true};
+    Simd::FRandom Known{Seed};
+    for(int32 Step{0}; Step < 3; ++Step)
+    {
+        const Simd::uint64_4 Values{Known.Next()};
+        for(int32 Lane{0}; Lane < 4; ++Lane)
+        {
+            bMatches = bMatches && Values[Lane] == KnownAnswers[Lane][Step];
+        }
+    }
+    CHECK(bMatches);
+
+    FReference Lanes[4];
+    MakeLanes(Lanes);
+    Simd::FRandom Streams{Seed};
+    CHECK(MatchesLanes(Streams, Lanes, 1000));
+}
+
+TEST(RandomJump)
+{
+    FReference Lanes[4];
+    MakeLanes(Lanes);
+    Simd::FRandom Random{Seed};
+
+    //Jump and LongJump move every lane on its own, also after some values were drawn
+    CHECK(MatchesLanes(Random, Lanes, 10));
+
+    for(FReference& Lane : Lanes)
+    {
+        Lane.Jump(JumpPolynomial);
+    }
+    Random.Jump();
+    CHECK(MatchesLanes(Random, Lanes, 100));
+
+    for(FReference& Lane : Lanes)
+    {
+        Lane.Jump(LongJumpPolynomial);
+    }
+    Random.LongJump();
+    CHECK(MatchesLanes(Random, Lanes, 100));
+}
+
+TEST(RandomBounded)
+{
+    Simd::FRandom Random{Seed};
+
+    //powers of two never reject, 3 rejects rarely and 2^31 + 1 rejects almost half of the time
+    bool bBelow{true};
+    for(const uint32 Range : {1u, 2u, 3u, 7u, 1000u, 0x80000001u, 0xFFFFFFFFu})
+    {
+        for(int32 Step{0}; Step < 1000; ++Step)
+        {
+            const Simd::uint32_8 Values{Random.NextBounded(Range)};
+            for(uint64 Lane{0}; Lane < Simd::uint32_8::NumElements; ++Lane)
+            {
+                bBelow = bBelow && Values[Lane] < Range;
+            }
+        }
+    }
+    CHECK(bBelow);
+
+    for(const uint64 Range : {1ull, 3ull, 1000ull, 0x8000000000000001ull, 0xFFFFFFFFFFFFFFFFull})
+    {
+        for(int32 Step{0}; Step < 1000; ++Step)
+        {
+            const Simd::uint64_4 Values{Random.NextBounded(Range)};
+            for(uint64 Lane{0}; Lane < Simd::uint64_4::NumElements; ++Lane)
+            {
+                bBelow = bBelow && Values[Lane] < Range;
+            }
+        }
+    }
+    CHECK(bBelow);
+
+    //every value of a small range shows up
+    uint32 Seen{0};
+    for(int32 Step{0}; Step < 100; ++Step)
+    {
+        const Simd::uint32_8 Values{Random.NextBounded(5u)};
+        for(uint64 Lane{0}; Lane < Simd::uint32_8::NumElements; ++Lane)
+        {
+            Seen |= 1u << Values[Lane];
+        }
+    }
+    CHECK(Seen == 0b11111);
+}
+
+TEST(RandomUniform)
+{
+    FReference Lanes[4];
+    MakeLanes(Lanes);
+    Simd::FRandom Random{Seed};
+
+    //the floats are exactly the scaled top bits of the reference outputs, which keeps them in [0, 1)
+    bool bMatches{true};
+    bool bInRange{true};
+    for(int32 Step{0}; Step < 1000; ++Step)
+    {
+        const Simd::float32_8 Floats{Random.NextFloat32()};
+        for(int32 Lane{0}; Lane < 4; ++Lane)
+        {
+            const uint64 Value{Lanes[Lane].Next()};
+            const float32 Low{Floats[Lane * 2]};
+            const float32 High{Floats[Lane * 2 + 1]};
+
+            bMatches = bMatches && Low == static_cast<float32>(static_cast<uint32>(Value) >> 8) * 0x1p-24f && High == static_cast<float32>(Value >> 40) * 0x1p-24f;
+            bInRange = bInRange && Low >= 0.f && Low < 1.f && High >= 0.f && High < 1.f;
+        }
+
+        const Simd::float64_4 Doubles{Random.NextFloat64()};
+        for(int32 Lane{0}; Lane < 4; ++Lane)
+        {
+            const float64 Value{Doubles[Lane]};
+            bMatches = bMatches && Value == static_cast<float64>(Lanes[Lane].Next() >> 12) * 0x1p-52;
+            bInRange = bInRange && Value >= 0.0 && Value < 1.0;
+        }
+    }
+    CHECK(bMatches);
+    CHECK(bInRange);
+
+    float32 Filled[37];
+    Random.FillUniform(Filled, 37);
+    for(const float32 Value : Filled)
+    {
+        bInRange = bInRange && Value >= 0.f && Value < 1.f;
+    }
+    CHECK(bInRange);
+}
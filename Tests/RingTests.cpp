@@ -0,0 +1,164 @@
+#include "Test.h"
+#include "../Ring.h"
+#include "../String.h"
+
+#include <thread>
+
+TEST(SpscRingWrap)
+{
+    Ring::TSpscRing<uint32> Queue{6};
+    CHECK(Queue.Capacity() == 8);
+
+    uint32 Items[8]{0, 1, 2, 3, 4, 5, 6, 7};
+    uint32 Out[8];
+
+    CHECK(Queue.Push(Items, 5) == 5);
+    CHECK(Queue.Pop(Out, 3) == 3 && Out[0] == 0 && Out[2] == 2);
+
+    //6 more only fit partly and wrap around the end of the buffer
+    CHECK(Queue.Push(Items, 8) == 6);
+    CHECK(Queue.Pop(Out, 8) == 8);
+    CHECK(Out[0] == 3 && Out[1] == 4 && Out[2] == 0 && Out[7] == 5);
+    CHECK(Queue.Pop(Out, 8) == 0);
+}
+
+TEST(SpscRingThreads)
+{
+    constexpr uint64 NumItems{200000};
+
+    Ring::TSpscRing<uint64> Queue{1024, true};
+
+    std::thread Producer{[&Queue]()
+    {
+        uint64 Batch[37];
+        for(uint64 Next{0}; Next < NumItems;)
+        {
+            const uint64 Num{NumItems - Next < 37 ? NumItems - Next : 1 + Next % 37};
+            for(uint64 Index{0}; Index < Num; ++Index)
+            {
+                Batch[Index] = Next + Index;
+            }
+
+            for(uint64 Pushed{0}; Pushed < Num;)
+            {
+                Pushed += Queue.Push(Batch + Pushed, Num - Pushed);
+            }
+
+            Next += Num;
+        }
+
+        Queue.Close();
+    }};
+
+    uint64 Expected{0};
+    bool bInOrder{true};
+
+    uint64 Out[64];
+    for(uint64 Num; (Num = Queue.PopWait(Out, 64)) > 0;)
+    {
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            bInOrder = bInOrder && Out[Index] == Expected++;
+        }
+    }
+
+    Producer.join();
+
+    CHECK(bInOrder);
+    CHECK(Expected == NumItems);
+}
+
+TEST(SpscRingStrings)
+{
+    Ring::TSpscRing<FStaticString> Queue{4};
+
+    const FStaticString Keys[2]{FStaticString{"alpha"}, FStaticString{"beta"}};
+    CHECK(Queue.Push(Keys, 2) == 2);
+
+    FStaticString Out[2];
+    CHECK(Queue.Pop(Out, 2) == 2);
+    CHECK(Out[0] == "alpha" && Out[1] == "beta");
+}
+
+//blocks carry a producer id and a running number, every block has to arrive exactly once
+TEST(MpmcRingThreads)
+{
+    constexpr uint32 NumProducers{3};
+    constexpr uint32 NumConsumers{3};
+    constexpr uint64 NumBlocks{20000};
+    constexpr uint32 BlockSize{8};
+
+    Ring::TMpmcRing<uint64, BlockSize> Queue{64, true};
+
+    std::atomic<uint64> Sum{0};
+    std::atomic<uint64> NumReceived{0};
+    std::atomic<bool> bValid{true};
+    std::atomic<uint32> NumRunning{NumProducers};
+
+    std::thread Producers[NumProducers];
+    for(uint32 Producer{0}; Producer < NumProducers; ++Producer)
+    {
+        Producers[Producer] = std::thread{[&Queue, &NumRunning, Producer]()
+        {
+            for(uint64 Block{0}; Block < NumBlocks; ++Block)
+            {
+                const uint32 Num{static_cast<uint32>(1 + Block % BlockSize)};
+
+                uint64 Items[BlockSize];
+                for(uint32 Index{0}; Index < Num; ++Index)
+                {
+                    Items[Index] = Producer * NumBlocks + Block;
+                }
+
+                while(!Queue.Push(Items, Num))
+                {
+                    __builtin_ia32_pause();
+                }
+            }
+
+            if(NumRunning.fetch_sub(1) == 1)
+            {
+                Queue.Close();
+            }
+        }};
+    }
+
+    std::thread Consumers[NumConsumers];
+    for(std::thread& Consumer : Consumers)
+    {
+        Consumer = std::thread{[&Queue, &Sum, &NumReceived, &bValid]()
+        {
+            uint64 Items[BlockSize];
+            for(uint32 Num; (Num = Queue.PopWait(Items)) > 0;)
+            {
+                bool bBlockValid{Num == 1 + Items[0] % NumBlocks % BlockSize};
+                for(uint32 Index{1}; Index < Num; ++Index)
+                {
+                    bBlockValid = bBlockValid && Items[Index] == Items[0];
+                }
+
+                if(!bBlockValid)
+                {
+                    bValid.store(false, std::memory_order_relaxed);
+                }
+
+                Sum.fetch_add(Items[0], std::memory_order_relaxed);
+                NumReceived.fetch_add(1, std::memory_order_relaxed);
+            }
+        }};
+    }
+
+    for(std::thread& Producer : Producers)
+    {
+        Producer.join();
+    }
+    for(std::thread& Consumer : Consumers)
+    {
+        Consumer.join();
+    }
+
+    const uint64 NumTotal{NumProducers * NumBlocks};
+    CHECK(bValid.load());
+    CHECK(NumReceived.load() == NumTotal);
+    CHECK(Sum.load() == NumTotal * (NumTotal - 1) / 2);
+}
@@ -0,0 +1,69 @@
+#include "Test.h"
+#include "../Search.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+    //sizes around the vector window, a node of the tree and a few tree levels
+    constexpr uint64 Sizes[]{0, 1, 7, 16, 17, 100, 1000, 4097};
+
+    //sorted with runs of duplicates, so the first of equal elements has to be found
+    template<typename T>
+    std::vector<T> MakeSorted(const uint64 Num)
+    {
+        std::vector<T> Data(Num);
+        for(uint64 Index{0}; Index < Num; ++Index)
+        {
+            Data[Index] = static_cast<T>(Index / 3 * 5) - static_cast<T>(100);
+        }
+
+        return Data;
+    }
+
+    template<typename TVector>
+    bool SearchesMatch()
+    {
+        using ElementType = typename TVector::ElementType;
+
+        bool bMatches{true};
+
+        for(const uint64 Num : Sizes)
+        {
+            const std::vector<ElementType> Data{MakeSorted<ElementType>(Num)};
+            const Simd::TSearchTree<TVector> Tree{Data.data(), Num};
+
+            //every stored value, the gaps between them and keys past both ends
+            std::vector<ElementType> Keys;
+            for(int64 Key{-110}; Key < static_cast<int64>(Num / 3 * 5) - 90; Key += Num > 1000 ? 7 : 1)
+            {
+                Keys.push_back(static_cast<ElementType>(Key));
+            }
+
+            std::vector<uint64> Batched(Keys.size());
+            std::vector<uint64> TreeBatched(Keys.size());
+            Simd::LowerBound<TVector>(Data.data(), Num, Keys.data(), Keys.size(), Batched.data());
+            Tree.LowerBound(Keys.data(), Keys.size(), TreeBatched.data());
+
+            for(uint64 Index{0}; Index < Keys.size(); ++Index)
+            {
+                const ElementType Key{Keys[Index]};
+                const uint64 Expected{static_cast<uint64>(std::lower_bound(Data.begin(), Data.end(), Key) - Data.begin())};
+
+                bMatches = bMatches && Simd::LowerBound<TVector>(Data.data(), Num, Key) == Expected && Batched[Index] == Expected
+                    && Tree.LowerBound(Key) == Expected && TreeBatched[Index] == Expected
+                    && Simd::CountLesser<TVector>(Data.data(), Num, Key) == Expected;
+            }
+        }
+
+        return bMatches;
+    }
+}
+
+TEST(SearchLowerBound)
+{
+    CHECK(SearchesMatch<Simd::int32_8>());
+    CHECK(SearchesMatch<Simd::float32_8>());
+    CHECK(SearchesMatch<Simd::int64_4>());
+}
@@ -0,0 +1,285 @@
+#include "Test.h"
+#include "../Simd.h"
+
+#include <bit>
+
+namespace
+{
+    template<typename TVector>
+    bool Equal(const TVector& LHS, const TVector& RHS)
+    {
+        return (LHS == RHS).All();
+    }
+
+    //xorshift, enough to spread values over every bit of the lanes
+    uint64 NextValue(uint64& State)
+    {
+        State ^= State << 13;
+        State ^= State >> 7;
+        State ^= State << 17;
+        return State;
+    }
+
+    template<typename TVector>
+    TVector MakeRandom(uint64& State)
+    {
+        TVector Result;
+        for(uint64 Lane{0}; Lane < TVector::NumElements; ++Lane)
+        {
+            Result[Lane] = static_cast<typename TVector::ElementType>(NextValue(State) >> (NextValue(State) & 63));
+        }
+        return Result;
+    }
+
+    //compares every lane of Operation against Scalar applied to the same lane over a few hundred random registers
+    template<typename TVector, typename TOperation, typename TScalar>
+    bool MatchesScalar(TOperation Operation, TScalar Scalar)
+    {
+        uint64 State{0x9E3779B97F4A7C15ull};
+
+        for(int32 Round{0}; Round < 256; ++Round)
+        {
+            const TVector Input{MakeRandom<TVector>(State)};
+            const TVector Output{Operation(Input)};
+
+            for(uint64 Lane{0}; Lane < TVector::NumElements; ++Lane)
+            {
+                if(Output[Lane] != static_cast<typename TVector::ElementType>(Scalar(Input[Lane])))
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    //the divisors are the low three bits of the lane minus three, so one lane in eight is a zero that the mask has to keep out of the division
+    template<typename TVector>
+    bool MaskedDivideMatches()
+    {
+        using ElementType = typename TVector::ElementType;
+
+        return MatchesScalar<TVector>([](const TVector& Input)
+        {
+            const TVector Divisors{(Input & TVector{static_cast<ElementType>(7)}) - TVector{static_cast<ElementType>(3)}};
+            return Simd::MaskedDivide(Divisors != TVector{}, Simd::ShiftRightBits<1>(Input), Divisors);
+        }, [](const ElementType Lane)
+        {
+            const ElementType Divisor{static_cast<ElementType>((Lane & 7) - 3)};
+            const ElementType Target{static_cast<ElementType>(Lane >> 1)};
+            return Divisor != 0 ? static_cast<ElementType>(Target / Divisor) : Target;
+        });
+    }
+
+    //every shift and rotate by Amount, once with the amount known at compile time and once at runtime
+    template<typename TVector, int32 Amount>
+    bool ShiftsMatch()
+    {
+        using ElementType = typename TVector::ElementType;
+        using UnsignedType = std::make_unsigned_t<ElementType>;
+        using SignedType = std::make_signed_t<ElementType>;
+
+        static volatile int32 AmountSource{Amount};
+        const int32 RuntimeAmount{AmountSource};
+
+        const auto Left = [](const ElementType Lane){ return static_cast<ElementType>(static_cast<UnsignedType>(static_cast<UnsignedType>(Lane) << Amount)); };
+        const auto Right = [](const ElementType Lane){ return static_cast<ElementType>(Lane >> Amount); };
+        const auto Logical = [](const ElementType Lane){ return static_cast<ElementType>(static_cast<UnsignedType>(Lane) >> Amount); };
+        const auto Arithmetic = [](const ElementType Lane){ return static_cast<ElementType>(static_cast<SignedType>(Lane) >> Amount); };
+        const auto RotateLeft = [](const ElementType Lane){ return static_cast<ElementType>(std::rotl(static_cast<UnsignedType>(Lane), Amount)); };
+        const auto RotateRight = [](const ElementType Lane){ return static_cast<ElementType>(std::rotr(static_cast<UnsignedType>(Lane), Amount)); };
+
+        return MatchesScalar<TVector>([](const TVector& Input){ return Simd::ShiftLeftBits<Amount>(Input); }, Left)
+            && MatchesScalar<TVector>([&](const TVector& Input){ return Simd::ShiftLeftBits(Input, RuntimeAmount); }, Left)
+            && MatchesScalar<TVector>([](const TVector& Input){ return Simd::ShiftRightBits<Amount>(Input); }, Right)
+            && MatchesScalar<TVector>([&](const TVector& Input){ return Simd::ShiftRightBits(Input, RuntimeAmount); }, Right)
+            && MatchesScalar<TVector>([](const TVector& Input){ return Simd::ShiftRightBitsLogical<Amount>(Input); }, Logical)
+            && MatchesScalar<TVector>([&](const TVector& Input){ return Simd::ShiftRightBitsLogical(Input, RuntimeAmount); }, Logical)
+            && MatchesScalar<TVector>([](const TVector& Input){ return Simd::ShiftRightBitsArithmetic<Amount>(Input); }, Arithmetic)
+            && MatchesScalar<TVector>([&](const TVector& Input){ return Simd::ShiftRightBitsArithmetic(Input, RuntimeAmount); }, Arithmetic)
+            && MatchesScalar<TVector>([](const TVector& Input){ return Simd::RotateLeftBits<Amount>(Input); }, RotateLeft)
+            && MatchesScalar<TVector>([&](const TVector& Input){ return Simd::RotateLeftBits(Input, RuntimeAmount); }, RotateLeft)
+            && MatchesScalar<TVector>([](const TVector& Input){ return Simd::RotateRightBits<Amount>(Input); }, RotateRight)
+            && MatchesScalar<TVector>([&](const TVector& Input){ return Simd::RotateRightBits(Input, RuntimeAmount); }, RotateRight);
+    }
+
+    //the per lane amounts are the low bits of the lane itself, so every amount from 0 to the lane width minus one shows up
+    template<typename TVector>
+    bool VariableShiftsMatch()
+    {
+        using ElementType = typename TVector::ElementType;
+        using UnsignedType = std::make_unsigned_t<ElementType>;
+
+        constexpr ElementType LaneMask{static_cast<ElementType>(Simd::ElementSize<TVector>() * 8 - 1)};
+
+        return MatchesScalar<TVector>([](const TVector& Input)
+        {
+            return Simd::ShiftLeftBits(Input, Input & TVector{LaneMask});
+        }, [](const ElementType Lane)
+        {
+            return static_cast<ElementType>(static_cast<UnsignedType>(static_cast<UnsignedType>(Lane) << (Lane & LaneMask)));
+        }) && MatchesScalar<TVector>([](const TVector& Input)
+        {
+            return Simd::ShiftRightBits(Input, Input & TVector{LaneMask});
+        }, [](const ElementType Lane)
+        {
+            return static_cast<ElementType>(Lane >> (Lane & LaneMask));
+        });
+    }
+
+    template<typename TVector>
+    bool AllShiftsMatch()
+    {
+        constexpr int32 LaneBits{Simd::ElementSize<TVector>() * 8};
+
+        return ShiftsMatch<TVector, 0>() && ShiftsMatch<TVector, 1>() && ShiftsMatch<TVector, 3>() && ShiftsMatch<TVector, LaneBits / 2>()
+            && ShiftsMatch<TVector, LaneBits - 1>() && VariableShiftsMatch<TVector>();
+    }
+}
+
+//the 32 byte branch once compared the raw vectors for equality instead of LHS > RHS
+TEST(CompareGreater8ByteLanes)
+{
+    CHECK(Simd::CompareGreater(Simd::int64_4{1, 5, 3, 7}, Simd::int64_4{2, 2, 2, 2}) == 0b1010);
+    CHECK(Simd::CompareGreater(Simd::int64_4{2, 2, 2, 2}, Simd::int64_4{2, 2, 2, 2}) == 0);
+    CHECK(Simd::CompareGreater(Simd::float64_4{1.0, 5.0, 3.0, 7.0}, Simd::float64_4{2.0}) == 0b1010);
+    CHECK(Simd::CompareGreater(Simd::int64_2{5, 1}, Simd::int64_2{2, 2}) == 0b01);
+}
+
+TEST(Compare4ByteLanes)
+{
+    const Simd::int32_8 LHS{1, 2, 3, 4, 5, 6, 7, 8};
+    const Simd::int32_8 RHS{4};
+
+    CHECK(Simd::CompareEqual(LHS, RHS) == 0b00001000);
+    CHECK(Simd::CompareNotEqual(LHS, RHS) == 0b11110111);
+    CHECK(Simd::CompareGreater(LHS, RHS) == 0b11110000);
+    CHECK(Simd::CompareGreaterOrEqual(LHS, RHS) == 0b11111000);
+    CHECK(Simd::CompareLesser(LHS, RHS) == 0b00000111);
+    CHECK(Simd::CompareLesserOrEqual(LHS, RHS) == 0b00001111);
+}
+
+TEST(MaskQueries)
+{
+    const Simd::int32_8 Values{1, 9, 3, 9, 5, 6, 7, 9};
+    const Simd::TVectorMask<Simd::int32_8> Mask{Values == Simd::int32_8{9}};
+
+    CHECK(Mask.Any());
+    CHECK(!Mask.All());
+    CHECK(Mask.Count() == 3);
+    CHECK(Mask.FirstSet() == 1);
+    CHECK(Equal(Simd::Select(Mask, Simd::int32_8{0}, Values), Simd::int32_8{1, 0, 3, 0, 5, 6, 7, 0}));
+
+    //pmovmskb gives 16 bit lanes two bits each, All has to expect 16 bits for the 8 lanes of a 16 byte register
+    const Simd::int16_8 Shorts{4, 4, 4, 4, 4, 4, 4, 4};
+    const Simd::TVectorMask<Simd::int16_8> AllSet{Shorts == Simd::int16_8{static_cast<int16>(4)}};
+    const Simd::TVectorMask<Simd::int16_8> LastClear{Shorts == Simd::int16_8{4, 4, 4, 4, 4, 4, 4, 5}};
+
+    CHECK(AllSet.All());
+    CHECK(!LastClear.All() && LastClear.Any());
+    CHECK(AllSet.Count() == 8 && LastClear.Count() == 7);
+    CHECK(LastClear.FirstSet() == 0);
+    CHECK(Equal(Shorts, Simd::int16_8{static_cast<int16>(4)}));
+}
+
+TEST(Absolute)
+{
+    CHECK(Equal(Simd::Absolute(Simd::int8_32{static_cast<int8>(-7)}), Simd::int8_32{static_cast<int8>(7)}));
+    CHECK(Equal(Simd::Absolute(Simd::int16_16{static_cast<int16>(-300)}), Simd::int16_16{static_cast<int16>(300)}));
+    CHECK(Equal(Simd::Absolute(Simd::int32_8{-1, 2, -3, 4, -5, 6, -7, 8}), Simd::int32_8{1, 2, 3, 4, 5, 6, 7, 8}));
+    CHECK(Equal(Simd::Absolute(Simd::int64_4{-1, 2, -3000000000ll, 4}), Simd::int64_4{1, 2, 3000000000ll, 4}));
+    CHECK(Equal(Simd::Absolute(Simd::int64_2{-9, 9}), Simd::int64_2{9, 9}));
+}
+
+TEST(SaturatingArithmetic)
+{
+    CHECK(Equal(Simd::AddSaturate(Simd::uint8_32{static_cast<uint8>(250)}, Simd::uint8_32{static_cast<uint8>(10)}), Simd::uint8_32{static_cast<uint8>(255)}));
+    CHECK(Equal(Simd::SubtractSaturate(Simd::uint8_32{static_cast<uint8>(5)}, Simd::uint8_32{static_cast<uint8>(10)}), Simd::uint8_32{static_cast<uint8>(0)}));
+    CHECK(Equal(Simd::AddSaturate(Simd::int16_16{static_cast<int16>(32000)}, Simd::int16_16{static_cast<int16>(1000)}), Simd::int16_16{static_cast<int16>(32767)}));
+    CHECK(Equal(Simd::SubtractSaturate(Simd::int16_16{static_cast<int16>(-32000)}, Simd::int16_16{static_cast<int16>(1000)}), Simd::int16_16{static_cast<int16>(-32768)}));
+}
+
+TEST(MultiplyHigh)
+{
+    CHECK(Equal(Simd::MultiplyHigh(Simd::int16_16{static_cast<int16>(-20000)}, Simd::int16_16{static_cast<int16>(30000)}), Simd::int16_16{static_cast<int16>((-20000 * 30000) >> 16)}));
+
+    const uint32 Factor32{0xDEADBEEF};
+    CHECK((MatchesScalar<Simd::uint32_8>([&](const Simd::uint32_8& Input)
+    {
+        return Simd::MultiplyHigh(Input, Simd::uint32_8{Factor32});
+    }, [&](const uint32 Lane)
+    {
+        return (static_cast<uint64>(Lane) * Factor32) >> 32;
+    })));
+
+    const int64 Factor64{-0x123456789ABCDEFll};
+    CHECK((MatchesScalar<Simd::int64_4>([&](const Simd::int64_4& Input)
+    {
+        return Simd::MultiplyHigh(Input, Simd::int64_4{Factor64});
+    }, [&](const int64 Lane)
+    {
+        return static_cast<int64>((static_cast<int128>(Lane) * Factor64) >> 64);
+    })));
+}
+
+TEST(BitCounts)
+{
+    CHECK((MatchesScalar<Simd::uint8_32>([](const Simd::uint8_32& Input){ return Simd::PopCount(Input); }, [](const uint8 Lane){ return __builtin_popcount(Lane); })));
+    CHECK((MatchesScalar<Simd::uint16_16>([](const Simd::uint16_16& Input){ return Simd::PopCount(Input); }, [](const uint16 Lane){ return __builtin_popcount(Lane); })));
+    CHECK((MatchesScalar<Simd::uint32_8>([](const Simd::uint32_8& Input){ return Simd::PopCount(Input); }, [](const uint32 Lane){ return __builtin_popcount(Lane); })));
+    CHECK((MatchesScalar<Simd::uint64_4>([](const Simd::uint64_4& Input){ return Simd::PopCount(Input); }, [](const uint64 Lane){ return __builtin_popcountll(Lane); })));
+
+    CHECK((MatchesScalar<Simd::uint16_16>([](const Simd::uint16_16& Input){ return Simd::CountLeadingZeros(Input); }, [](const uint16 Lane){ return Lane == 0 ? 16 : __builtin_clz(Lane) - 16; })));
+    CHECK((MatchesScalar<Simd::uint32_8>([](const Simd::uint32_8& Input){ return Simd::CountLeadingZeros(Input); }, [](const uint32 Lane){ return Lane == 0 ? 32 : __builtin_clz(Lane); })));
+    CHECK((MatchesScalar<Simd::uint64_4>([](const Simd::uint64_4& Input){ return Simd::CountLeadingZeros(Input); }, [](const uint64 Lane){ return Lane == 0 ? 64 : __builtin_clzll(Lane); })));
+
+    CHECK((MatchesScalar<Simd::uint32_8>([](const Simd::uint32_8& Input){ return Simd::CountTrailingZeros(Input); }, [](const uint32 Lane){ return Lane == 0 ? 32 : __builtin_ctz(Lane); })));
+    CHECK((MatchesScalar<Simd::uint64_4>([](const Simd::uint64_4& Input){ return Simd::CountTrailingZeros(Input); }, [](const uint64 Lane){ return Lane == 0 ? 64 : __builtin_ctzll(Lane); })));
+}
+
+TEST(WidenAndNarrow)
+{
+    uint64 State{42};
+    const Simd::uint8_32 Bytes{MakeRandom<Simd::uint8_32>(State)};
+
+    const Simd::uint16_16 Low{Simd::WidenLow<Simd::uint16_16>(Bytes)};
+    const Simd::uint16_16 High{Simd::WidenHigh<Simd::uint16_16>(Bytes)};
+
+    CHECK(Low[0] == Bytes[0] && High[0] == Bytes[16]);
+    CHECK(Equal(Simd::Narrow<Simd::uint8_32>(Low, High), Bytes));
+
+    const Simd::int16_16 Wide{static_cast<int16>(1000)};
+    CHECK(Equal(Simd::NarrowSaturate<Simd::int8_32>(Wide, Wide), Simd::int8_32{static_cast<int8>(127)}));
+}
+
+TEST(MaskedArithmetic)
+{
+    const Simd::int32_8 Values{1, 2, 3, 4, 5, 6, 7, 8};
+    const Simd::TVectorMask<Simd::int32_8> Odd{(Values & Simd::int32_8{1}) != Simd::int32_8{}};
+
+    CHECK(Equal(Simd::MaskedAdd(Odd, Values, Simd::int32_8{10}), Simd::int32_8{11, 2, 13, 4, 15, 6, 17, 8}));
+    CHECK(Equal(Simd::MaskedSubtract(Odd, Values, Simd::int32_8{1}), Simd::int32_8{0, 2, 2, 4, 4, 6, 6, 8}));
+    CHECK(Equal(Simd::MaskedMultiply(Odd, Values, Simd::int32_8{3}), Simd::int32_8{3, 2, 9, 4, 15, 6, 21, 8}));
+
+    //a zero divisor in a masked off lane must not reach the division
+    CHECK(MaskedDivideMatches<Simd::int32_8>());
+    CHECK(MaskedDivideMatches<Simd::uint32_8>());
+    CHECK(MaskedDivideMatches<Simd::int64_4>());
+    CHECK(MaskedDivideMatches<Simd::int16_16>());
+}
+
+//the 8 bit lanes and the 64 bit arithmetic shift without AVX512 are emulated, the 32 and 64 bit rotates use vprold / vprolq with AVX512
+TEST(ShiftsAndRotates)
+{
+    CHECK(AllShiftsMatch<Simd::int8_32>());
+    CHECK(AllShiftsMatch<Simd::uint8_32>());
+    CHECK(AllShiftsMatch<Simd::uint8_16>());
+    CHECK(AllShiftsMatch<Simd::int16_16>());
+    CHECK(AllShiftsMatch<Simd::uint16_16>());
+    CHECK(AllShiftsMatch<Simd::int32_8>());
+    CHECK(AllShiftsMatch<Simd::uint32_8>());
+    CHECK(AllShiftsMatch<Simd::int64_4>());
+    CHECK(AllShiftsMatch<Simd::uint64_4>());
+    CHECK(AllShiftsMatch<Simd::int64_2>());
+}
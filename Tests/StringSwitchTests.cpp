@@ -0,0 +1,128 @@
+#include "Test.h"
+#include "../StringSwitch.h"
+
+namespace
+{
+    constexpr auto Commands{MakeStaticStringSwitch<"open", "close", "read", "write", "seek", "flush", "a", "", "0123456789012345678901234567890">()};
+
+    static_assert(Commands.IndexOf("open") == 0);
+    static_assert(Commands.IndexOf("0123456789012345678901234567890") == 8);
+
+    constexpr char8 Keywords[][16]{"alignas", "alignof", "auto", "bool", "break", "case", "catch", "char", "class", "concept",
+        "const", "consteval", "constexpr", "constinit", "continue", "decltype", "default", "delete", "do", "double", "else", "enum",
+        "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace",
+        "new", "noexcept", "nullptr", "operator", "private", "protected", "public", "requires", "return", "short", "signed", "sizeof",
+        "static", "struct", "switch", "template", "this", "throw", "true", "try", "typedef", "typename", "union", "unsigned", "using",
+        "virtual", "void", "volatile", "while"};
+
+    constexpr uint64 NumKeywords{sizeof(Keywords) / sizeof(Keywords[0])};
+
+    //"name" followed by the decimal Index, the same few characters in every key make the hash do the work
+    constexpr void WriteName(const uint64 Index, char8 (&Out)[16])
+    {
+        char8 Digits[8]{};
+        uint64 NumDigits{0};
+        uint64 Value{Index};
+
+        do
+        {
+            Digits[NumDigits++] = static_cast<char8>('0' + Value % 10);
+            Value /= 10;
+        }
+        while(Value > 0);
+
+        Out[0] = 'n';
+        Out[1] = 'a';
+        Out[2] = 'm';
+        Out[3] = 'e';
+
+        for(uint64 Digit{0}; Digit < NumDigits; ++Digit)
+        {
+            Out[4 + Digit] = Digits[NumDigits - 1 - Digit];
+        }
+    }
+
+    template<uint64 Index>
+    consteval TStringLiteral<16> GeneratedName()
+    {
+        char8 Name[16]{};
+        WriteName(Index, Name);
+        return TStringLiteral<16>{Name};
+    }
+
+    template<uint64... Indices>
+    consteval auto MakeKeywordSwitch(std::integer_sequence<uint64, Indices...>)
+    {
+        return MakeStaticStringSwitch<TStringLiteral<16>{Keywords[Indices]}...>();
+    }
+
+    template<uint64... Indices>
+    consteval auto MakeGeneratedSwitch(std::integer_sequence<uint64, Indices...>)
+    {
+        return MakeStaticStringSwitch<GeneratedName<Indices>()...>();
+    }
+
+    int32 Dispatch(const FStaticString& Name)
+    {
+        switch(Commands.Find(Name))
+        {
+            case Commands.IndexOf("read"):
+                return 10;
+            case Commands.IndexOf("write"):
+                return 20;
+            default:
+                return 0;
+        }
+    }
+}
+
+TEST(StaticStringSwitchFind)
+{
+    CHECK(Commands.Find(FStaticString{"open"}) == 0);
+    CHECK(Commands.Find(FStaticString{"close"}) == 1);
+    CHECK(Commands.Find(FStaticString{"flush"}) == 5);
+    CHECK(Commands.Find(FStaticString{"a"}) == 6);
+    CHECK(Commands.Find(FStaticString{""}) == 7);
+    CHECK(Commands.Find(FStaticString{"0123456789012345678901234567890"}) == 8);
+
+    CHECK(Commands.Find(FStaticString{"opens"}) == Commands.NotFound);
+    CHECK(Commands.Find(FStaticString{"b"}) == Commands.NotFound);
+    CHECK(Commands.Find(FStaticString{"0123456789012345678901234567891"}) == Commands.NotFound);
+
+    CHECK(Dispatch(FStaticString{"read"}) == 10);
+    CHECK(Dispatch(FStaticString{"write"}) == 20);
+    CHECK(Dispatch(FStaticString{"seek"}) == 0);
+}
+
+//enough keys for buckets to collide and some pilots to be needed, every key has to be found at its own position
+TEST(StaticStringSwitchLarge)
+{
+    constexpr auto KeywordSwitch{MakeKeywordSwitch(std::make_integer_sequence<uint64, NumKeywords>{})};
+
+    bool bMatches{true};
+    for(uint64 Index{0}; Index < NumKeywords; ++Index)
+    {
+        bMatches = bMatches && KeywordSwitch.Find(FStaticString{Keywords[Index]}) == static_cast<int32>(Index);
+    }
+    CHECK(bMatches);
+
+    CHECK(KeywordSwitch.Find(FStaticString{"module"}) == KeywordSwitch.NotFound);
+    CHECK(KeywordSwitch.Find(FStaticString{"While"}) == KeywordSwitch.NotFound);
+}
+
+//several hundred keys, the size the table is meant to build within the default constexpr limits
+TEST(StaticStringSwitchHundreds)
+{
+    constexpr uint64 NumNames{500};
+    constexpr auto Names{MakeGeneratedSwitch(std::make_integer_sequence<uint64, NumNames>{})};
+
+    bool bMatches{true};
+    for(uint64 Index{0}; Index < NumNames + 100; ++Index)
+    {
+        char8 Name[16]{};
+        WriteName(Index, Name);
+
+        bMatches = bMatches && Names.Find(FStaticString{Name}) == (Index < NumNames ? static_cast<int32>(Index) : Names.NotFound);
+    }
+    CHECK(bMatches);
+}
@@ -0,0 +1,58 @@
+#include "Test.h"
+#include "../String.h"
+
+TEST(StaticStringCompare)
+{
+    const FStaticString Hello{"hello"};
+
+    CHECK(Hello == "hello");
+    CHECK(Hello != "hellO");
+    CHECK(Hello != "hello!");
+    CHECK(FStaticString::MakeFromRaw("hello") == Hello);
+}
+
+TEST(StaticStringLength)
+{
+    CHECK(FStaticString{""}.Length() == 0);
+    CHECK(FStaticString{"hello"}.Length() == 5);
+    CHECK(FStaticString{"0123456789012345678901234567890"}.Length() == 31);
+    CHECK(StringUtility::Length("hello world") == 11);
+}
+
+TEST(StaticStringEdit)
+{
+    FStaticString String{"hello"};
+    String.Append(" world");
+
+    CHECK(String == "hello world");
+
+    FStaticString Start{String};
+    Start.RemoveFromEnd(6);
+    CHECK(Start == "hello");
+
+    FStaticString End{String};
+    End.RemoveFromStart(6);
+    CHECK(End == "world");
+}
+
+TEST(StaticStringSearch)
+{
+    const FStaticString String{"hello world"};
+
+    CHECK(String.Contains("hello"));
+    CHECK(String.Contains("o w"));
+    CHECK(String.Contains("world"));
+    CHECK(!String.Contains("worlds"));
+    CHECK(!String.Contains("xyz"));
+}
+
+TEST(StaticStringCase)
+{
+    FStaticString String{"Hello, World 42"};
+
+    String.ToUppercase();
+    CHECK(String == "HELLO, WORLD 42");
+
+    String.ToLowercase();
+    CHECK(String == "hello, world 42");
+}
@@ -0,0 +1,195 @@
+#include "Test.h"
+#include "../Structural.h"
+
+#include <vector>
+
+namespace
+{
+    //One character at a time with the same rules as the scanner: a backslash escapes the next character unless it is escaped itself,
+    //unescaped quotes toggle the inside of a string, and a JSON scalar starts where a character that is neither an operator,
+    //whitespace nor a quote follows something else
+    class FReferenceScanner final
+    {
+    public:
+
+        explicit FReferenceScanner(const Structural::EFormat InFormat)
+            : Format(InFormat)
+        {
+        }
+
+        void Scan(const char8* Data, const uint32 Size, const uint32 Base, std::vector<uint32>& Out)
+        {
+            for(uint32 Index{0}; Index < Size; ++Index)
+            {
+                const char8 Character{Data[Index]};
+
+                const bool bEscaped{Format == Structural::EFormat::Json && bEscapeNext};
+                bEscapeNext = Character == '\\' && !bEscaped;
+
+                const bool bQuote{Character == '"' && !bEscaped};
+                const bool bWasInside{bInside};
+                bInside = bInside != bQuote;
+
+                if(Format == Structural::EFormat::Csv)
+                {
+                    if(!bWasInside && !bQuote && (Character == ',' || Character == '\n'))
+                    {
+                        Out.push_back(Base + Index);
+                    }
+
+                    continue;
+                }
+
+                const bool bOperator{Character == '{' || Character == '}' || Character == '[' || Character == ']' || Character == ':' || Character == ','};
+                const bool bScalar{!bOperator && Character != ' ' && Character != '\t' && Character != '\r' && Character != '\n'};
+
+                //the opening quote is the start of the string, everything after it up to and including the closing quote is not
+                if(!bWasInside && (bOperator || (bScalar && !bPreviousScalar)))
+                {
+                    Out.push_back(Base + Index);
+                }
+
+                bPreviousScalar = bScalar && !bQuote;
+            }
+        }
+
+    private:
+
+        Structural::EFormat Format;
+
+        bool bEscapeNext{false};
+        bool bInside{false};
+        bool bPreviousScalar{false};
+    };
+
+    std::vector<uint32> Scan(const Structural::EFormat Format, const char8* Data, const uint32 Size, const uint32 PieceSize)
+    {
+        Structural::FScanner Scanner{Format};
+        std::vector<uint32> Out(Size + 1);
+
+        uint64 NumIndices{0};
+        for(uint32 Offset{0}; Offset < Size; Offset += PieceSize)
+        {
+            const uint32 Piece{Size - Offset < PieceSize ? Size - Offset : PieceSize};
+            const uint64 NumInPiece{Scanner.Scan(Data + Offset, Piece, Out.data() + NumIndices)};
+
+            for(uint64 Index{NumIndices}; Index < NumIndices + NumInPiece; ++Index)
+            {
+                Out[Index] += Offset;
+            }
+
+            NumIndices += NumInPiece;
+        }
+
+        Out.resize(NumIndices);
+        return Out;
+    }
+
+    std::vector<uint32> ReferenceScan(const Structural::EFormat Format, const char8* Data, const uint32 Size)
+    {
+        FReferenceScanner Reference{Format};
+        std::vector<uint32> Out;
+        Reference.Scan(Data, Size, 0, Out);
+        return Out;
+    }
+
+    //places the end of Prefix right before the 64 byte boundary so what follows starts a new chunk
+    std::vector<char8> AcrossBoundary(const char8* Prefix, const char8* Suffix)
+    {
+        std::vector<char8> Text(Structural::ChunkSize, 'x');
+        Text[0] = '"';
+
+        const uint64 PrefixSize{__builtin_strlen(Prefix)};
+        Memory::Copy(Text.data() + Structural::ChunkSize - PrefixSize, Prefix, PrefixSize);
+        Text.insert(Text.end(), Suffix, Suffix + __builtin_strlen(Suffix));
+
+        return Text;
+    }
+}
+
+TEST(StructuralPrefixXor)
+{
+    CHECK(Structural::PrefixXor(0) == 0);
+    CHECK(Structural::PrefixXor(0b1) == ~0ull);
+    CHECK(Structural::PrefixXor(0b100100) == 0b011100);
+    CHECK(Structural::PrefixXor(1ull << 63) == 1ull << 63);
+    CHECK(Structural::PrefixXor(0b10001 | 1ull << 40) == (0b01111 | ~((1ull << 40) - 1)));
+}
+
+TEST(StructuralEscapesAcrossChunks)
+{
+    //one backslash at byte 63 escapes the quote at byte 64, the string goes on until the next quote
+    const std::vector<char8> Escaped{AcrossBoundary("\\", "\"x\",1")};
+    const std::vector<uint32> EscapedIndices{Scan(Structural::EFormat::Json, Escaped.data(), static_cast<uint32>(Escaped.size()), 64)};
+
+    CHECK(EscapedIndices.size() == 3 && EscapedIndices[0] == 0 && EscapedIndices[1] == 67 && EscapedIndices[2] == 68);
+
+    //two backslashes escape each other, so the quote at byte 64 closes the string
+    const std::vector<char8> Closed{AcrossBoundary("\\\\", "\",1")};
+    const std::vector<uint32> ClosedIndices{Scan(Structural::EFormat::Json, Closed.data(), static_cast<uint32>(Closed.size()), 64)};
+
+    CHECK(ClosedIndices.size() == 3 && ClosedIndices[0] == 0 && ClosedIndices[1] == 65 && ClosedIndices[2] == 66);
+
+    //an open string at the end of a piece stays open in the next one
+    Structural::FScanner Scanner{Structural::EFormat::Json};
+    uint32 Out[64];
+
+    CHECK(Scanner.Scan(Escaped.data(), 64, Out) == 1);
+    CHECK(Scanner.IsInsideString());
+}
+
+TEST(StructuralCsv)
+{
+    const char8 Text[]{"a,\"b\"\",c\",d\n\"\"\"\",e\n"};
+    const uint32 Size{sizeof(Text) - 1};
+
+    const std::vector<uint32> Indices{Scan(Structural::EFormat::Csv, Text, Size, 64)};
+    const std::vector<uint32> Expected{1, 9, 11, 16, 18};
+
+    CHECK(Indices == Expected);
+}
+
+TEST(StructuralTailPadding)
+{
+    //the last chunk is padded with spaces, a scalar running into the end is still found and nothing is reported past the end
+    const char8 Text[]{"{\"key\": [1, 22, 333], \"other\": true, \"x\": \"long enough to leave the first chunk\", \"n\": 123"};
+    const uint32 Size{sizeof(Text) - 1};
+
+    const std::vector<uint32> Indices{Scan(Structural::EFormat::Json, Text, Size, 64)};
+
+    CHECK(Indices == ReferenceScan(Structural::EFormat::Json, Text, Size));
+    CHECK(!Indices.empty() && Indices.back() == Size - 3);
+}
+
+TEST(StructuralRandom)
+{
+    //mostly quotes and backslashes so escape runs and strings cross the chunk boundaries often
+    constexpr char8 Alphabet[]{'"', '"', '\\', '\\', '\\', 'a', '1', ' ', '\n', ',', ':', '{', '}', '[', ']'};
+
+    uint64 State{0x9E3779B97F4A7C15};
+    bool bMatches{true};
+
+    for(uint32 Round{0}; Round < 200; ++Round)
+    {
+        const uint32 Size{static_cast<uint32>(Round * 7 % 300)};
+
+        std::vector<char8> Text(Size + 1);
+        for(uint32 Index{0}; Index < Size; ++Index)
+        {
+            State ^= State << 13;
+            State ^= State >> 7;
+            State ^= State << 17;
+            Text[Index] = Alphabet[State % sizeof(Alphabet)];
+        }
+
+        for(const Structural::EFormat Format : {Structural::EFormat::Json, Structural::EFormat::Csv})
+        {
+            const std::vector<uint32> Expected{ReferenceScan(Format, Text.data(), Size)};
+
+            bMatches = bMatches && Scan(Format, Text.data(), Size, 64) == Expected && Scan(Format, Text.data(), Size, 128) == Expected
+                && Scan(Format, Text.data(), Size, Size + 1) == Expected;
+        }
+    }
+
+    CHECK(bMatches);
+}
@@ -0,0 +1,66 @@
+#include <cstdio>
+#include "Test.h"
+#include "../Simd.h"
+
+namespace
+{
+    struct FTestCase
+    {
+        const char8* Name;
+        Test::FTestFunction Function;
+    };
+
+    constexpr int32 MaxTests{512};
+
+    //filled during static initialization, so it must not depend on a constructor running first
+    FTestCase Tests[MaxTests];
+    int32 NumTests{0};
+
+    int32 NumFailures{0};
+
+    //returned when the cpu lacks the instruction set, ctest counts it as skipped
+    constexpr int32 SkipReturnCode{77};
+}
+
+bool Test::Register(const char8* Name, FTestFunction Function)
+{
+    if(NumTests < MaxTests)
+    {
+        Tests[NumTests++] = FTestCase{Name, Function};
+    }
+
+    return true;
+}
+
+void Test::Fail(const char8* Expression, const char8* File, const int32 Line)
+{
+    std::printf("    %s:%d: CHECK(%s) failed\n", File, Line, Expression);
+    ++NumFailures;
+}
+
+int main()
+{
+    if(!Simd::IsSupportedByCpu())
+    {
+        std::printf("%s is not supported by this cpu, skipping\n", SIMD_ISA_NAME);
+        return SkipReturnCode;
+    }
+
+    int32 NumFailedTests{0};
+
+    for(int32 Index{0}; Index < NumTests; ++Index)
+    {
+        const int32 FailuresBefore{NumFailures};
+
+        Tests[Index].Function();
+
+        const bool bPassed{NumFailures == FailuresBefore};
+        NumFailedTests += bPassed ? 0 : 1;
+
+        std::printf("[%s] %s\n", bPassed ? "pass" : "FAIL", Tests[Index].Name);
+    }
+
+    std::printf("%s: %d of %d tests passed\n", SIMD_ISA_NAME, NumTests - NumFailedTests, NumTests);
+
+    return NumFailedTests == 0 ? 0 : 1;
+}
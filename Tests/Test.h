@@ -0,0 +1,35 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "../Definitions.h"
+
+//Minimal self registering tests, every TEST body runs once from Test.cpp and a failed CHECK reports the expression without stopping the test
+namespace Test
+{
+
+    using FTestFunction = void (*)();
+
+    bool Register(const char8* Name, FTestFunction Function);
+
+    void Fail(const char8* Expression, const char8* File, const int32 Line);
+
+}
+
+#define TEST(Name) \
+    static void Test##Name(); \
+    [[maybe_unused]] static const bool bRegistered##Name{Test::Register(#Name, &Test##Name)}; \
+    static void Test##Name()
+
+#define CHECK(Expression) ((Expression) ? static_cast<void>(0) : Test::Fail(#Expression, __FILE__, __LINE__))
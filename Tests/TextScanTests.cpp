@@ -0,0 +1,141 @@
+#include "Test.h"
+#include "../MappedFile.h"
+#include "../TextScan.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <unistd.h>
+
+namespace
+{
+    //lines of varying length so matches and newlines fall on both sides of the 64 byte blocks, no newline at the end
+    uint64 MakeText(char8* Text, const uint64 MaxSize)
+    {
+        const char8* Words[]{"error", "warning: disk", "ok", "", "error: timeout after 30s", "the errors were ignored"};
+
+        uint64 Size{0};
+        for(uint64 Line{0}; Size + 64 < MaxSize; ++Line)
+        {
+            const char8* Word{Words[(Line * 7) % 6]};
+            const uint64 Length{StringUtility::Length(Word)};
+
+            Memory::Copy(Text + Size, Word, Length);
+            Size += Length;
+
+            for(uint64 Pad{0}; Pad < Line % 11; ++Pad)
+            {
+                Text[Size++] = '.';
+            }
+
+            Text[Size++] = '\n';
+        }
+
+        return Size - 1;
+    }
+}
+
+TEST(TextScanLines)
+{
+    char8 Text[4000];
+    const uint64 Size{MakeText(Text, sizeof(Text))};
+
+    uint64 NumNewlines{0};
+    for(uint64 Index{0}; Index < Size; ++Index)
+    {
+        NumNewlines += Text[Index] == '\n';
+    }
+
+    CHECK(TextScan::CountLines(Text, Size) == NumNewlines + 1);
+    CHECK(TextScan::CountLines(Text, Size + 1) == NumNewlines + 1);
+    CHECK(TextScan::CountLines(Text, 0) == 0);
+
+    //the spans have to tile the text exactly, separated by single newlines
+    TextScan::FLineScanner Scanner{Text, Size};
+
+    uint64 NumLines{0};
+    uint64 Expected{0};
+    bool bTiled{true};
+
+    for(FLineSpan Line; Scanner.Next(Line);)
+    {
+        bTiled = bTiled && Line.Begin == Expected && (Line.Begin + Line.Length == Size || Text[Line.Begin + Line.Length] == '\n');
+        Expected = Line.Begin + Line.Length + 1;
+        ++NumLines;
+    }
+
+    CHECK(bTiled);
+    CHECK(NumLines == NumNewlines + 1);
+}
+
+TEST(TextScanMatches)
+{
+    char8 Text[4000];
+    const uint64 Size{MakeText(Text, sizeof(Text))};
+
+    for(const FStaticString& Needle : {FStaticString{"error"}, FStaticString{"e"}, FStaticString{"....."}, FStaticString{"error: timeout after 30s"}})
+    {
+        const uint64 Length{Needle.Length()};
+
+        uint64 NumExpected{0};
+        for(uint64 Index{0}; Index + Length <= Size; ++Index)
+        {
+            NumExpected += __builtin_memcmp(Text + Index, Needle.RawString(), Length) == 0;
+        }
+
+        TextScan::FMatchScanner Scanner{Text, Size, Needle};
+
+        uint64 NumFound{0};
+        uint64 Previous{0};
+        bool bValid{true};
+
+        for(uint64 Position; Scanner.Next(Position);)
+        {
+            bValid = bValid && (NumFound == 0 || Position > Previous) && __builtin_memcmp(Text + Position, Needle.RawString(), Length) == 0;
+            Previous = Position;
+            ++NumFound;
+        }
+
+        CHECK(bValid);
+        CHECK(NumFound == NumExpected);
+        CHECK(TextScan::CountMatches(Text, Size, Needle) == NumExpected);
+    }
+
+    //a needle that ends exactly at the last byte
+    CHECK(TextScan::CountMatches("abcab", 5, FStaticString{"ab"}) == 2);
+    CHECK(TextScan::CountMatches("abc", 3, FStaticString{""}) == 0);
+
+    const FLineSpan Line{TextScan::LineAround("one\ntwo\nthree", 13, 5)};
+    CHECK(Line.Begin == 4 && Line.Length == 3);
+}
+
+TEST(MappedFile)
+{
+    char8 Path[]{"/tmp/SimdTextScanXXXXXX"};
+    const int32 Descriptor{mkstemp(Path)};
+    CHECK(Descriptor >= 0);
+
+    if(Descriptor < 0)
+    {
+        return;
+    }
+
+    char8 Text[4000];
+    const uint64 Size{MakeText(Text, sizeof(Text))};
+    CHECK(write(Descriptor, Text, Size) == static_cast<int64>(Size));
+    close(Descriptor);
+
+    FMappedFile File;
+    CHECK(File.Open(Path));
+    CHECK(File.IsOpen() && File.GetSize() == Size);
+    CHECK(TextScan::CountLines(File.GetData(), File.GetSize()) == TextScan::CountLines(Text, Size));
+    CHECK(TextScan::CountMatches(File.GetData(), File.GetSize(), FStaticString{"error"}) == TextScan::CountMatches(Text, Size, FStaticString{"error"}));
+
+    File.ReleaseBefore(Size);
+    CHECK(__builtin_memcmp(File.GetData(), Text, Size) == 0);
+
+    File.Close();
+    CHECK(!File.IsOpen());
+    unlink(Path);
+
+    CHECK(!File.Open("/nonexistent/SimdTextScan"));
+}
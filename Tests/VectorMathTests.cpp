@@ -0,0 +1,184 @@
+#include "Test.h"
+#include "../VectorMath.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr float32 Tolerance{1e-4f};
+
+    bool Near(const float32 LHS, const float32 RHS)
+    {
+        return std::fabs(LHS - RHS) <= Tolerance;
+    }
+
+    bool Near3(const FVector4& LHS, const FVector4& RHS)
+    {
+        return Near(LHS.X(), RHS.X()) && Near(LHS.Y(), RHS.Y()) && Near(LHS.Z(), RHS.Z());
+    }
+
+    bool Near4(const Simd::float32_4& LHS, const Simd::float32_4& RHS)
+    {
+        return Near(LHS[0], RHS[0]) && Near(LHS[1], RHS[1]) && Near(LHS[2], RHS[2]) && Near(LHS[3], RHS[3]);
+    }
+
+    bool NearIdentity(const FMatrix44& Matrix)
+    {
+        bool bMatches{true};
+        for(int32 Row{0}; Row < 4; ++Row)
+        {
+            for(int32 Column{0}; Column < 4; ++Column)
+            {
+                bMatches = bMatches && Near(Matrix(Row, Column), Row == Column ? 1.f : 0.f);
+            }
+        }
+        return bMatches;
+    }
+
+    //deterministic values in [-1, 1)
+    float32 MakeValue(const uint64 Seed)
+    {
+        return static_cast<float32>(static_cast<int64>((Seed * 0x9E3779B97F4A7C15ull) >> 44) - (1ll << 19)) / static_cast<float32>(1ll << 19);
+    }
+
+    FVector4 MakeVector(const uint64 Seed)
+    {
+        return FVector4{MakeValue(Seed * 4 + 1) * 10.f, MakeValue(Seed * 4 + 2) * 10.f, MakeValue(Seed * 4 + 3) * 10.f};
+    }
+
+    FQuat MakeRotation(const uint64 Seed)
+    {
+        const FVector4 Axis{FVector4{MakeValue(Seed * 4 + 1), MakeValue(Seed * 4 + 2), MakeValue(Seed * 4 + 3) + 2.f}.Normal3()};
+        return FQuat::FromAxisAngle(Axis, MakeValue(Seed * 4 + 4) * 3.f);
+    }
+
+    FTransform MakeTransform(const uint64 Seed)
+    {
+        const FVector4 Scale{1.f + MakeValue(Seed * 3 + 5) * 0.5f, 1.f + MakeValue(Seed * 3 + 6) * 0.5f, 1.f + MakeValue(Seed * 3 + 7) * 0.5f};
+        return FTransform{MakeRotation(Seed), MakeVector(Seed + 100), Scale};
+    }
+}
+
+TEST(VectorMathMatrixInverse)
+{
+    bool bMatches{true};
+
+    for(uint64 Seed{0}; Seed < 32; ++Seed)
+    {
+        const FMatrix44 Affine{MakeTransform(Seed).ToMatrix()};
+        bMatches = bMatches && NearIdentity(Affine * Affine.Inverse()) && NearIdentity(Affine.Inverse() * Affine);
+    }
+    CHECK(bMatches);
+
+    //a projective matrix, the last column is not (0, 0, 0, 1)
+    const FMatrix44 General{FVector4{2.f, 1.f, 0.f, 1.f}, FVector4{0.f, 3.f, 1.f, 0.f}, FVector4{1.f, 0.f, 2.f, 1.f}, FVector4{0.f, 1.f, 1.f, 2.f}};
+    CHECK(NearIdentity(General * General.Inverse()));
+    CHECK(NearIdentity(FMatrix44::Identity().Inverse()));
+}
+
+TEST(VectorMathQuatRotation)
+{
+    bool bMatches{true};
+
+    for(uint64 Seed{0}; Seed < 32; ++Seed)
+    {
+        const FQuat First{MakeRotation(Seed)};
+        const FQuat Second{MakeRotation(Seed + 50)};
+        const FVector4 Vector{MakeVector(Seed)};
+
+        bMatches = bMatches && Near3(First.RotateVector(Vector), First.ToMatrix().TransformVector4(Vector));
+        bMatches = bMatches && Near3((Second * First).RotateVector(Vector), Second.RotateVector(First.RotateVector(Vector)));
+        bMatches = bMatches && Near3(First.Inverse().RotateVector(First.RotateVector(Vector)), Vector);
+
+        const FTransform Transform{MakeTransform(Seed)};
+        const FTransform Other{MakeTransform(Seed + 50)};
+        bMatches = bMatches && Near3(Transform.TransformPosition(Vector), Transform.ToMatrix().TransformPosition(Vector));
+
+        //uniform scale keeps the combined transform exact
+        const FTransform Uniform{MakeRotation(Seed + 7), MakeVector(Seed + 7), FVector4{2.f, 2.f, 2.f}};
+        bMatches = bMatches && Near3((Transform * Uniform).TransformPosition(Vector), Uniform.TransformPosition(Transform.TransformPosition(Vector)));
+        bMatches = bMatches && Near3((Other * Uniform).TransformVector(Vector), Uniform.TransformVector(Other.TransformVector(Vector)));
+    }
+    CHECK(bMatches);
+
+    //a quarter turn around Z takes X to Y
+    const FQuat Quarter{FQuat::FromAxisAngle(FVector4{0.f, 0.f, 1.f}, 1.5707963f)};
+    CHECK(Near3(Quarter.RotateVector(FVector4{1.f, 0.f, 0.f}), FVector4{0.f, 1.f, 0.f}));
+}
+
+TEST(VectorMathSlerp)
+{
+    const FVector4 Axis{FVector4{1.f, 2.f, 3.f}.Normal3()};
+    const FQuat From{FQuat::FromAxisAngle(Axis, 0.2f)};
+    const FQuat To{FQuat::FromAxisAngle(Axis, 1.8f)};
+
+    CHECK(Near4(FQuat::Slerp(From, To, 0.f).Vector, From.Vector));
+    CHECK(Near4(FQuat::Slerp(From, To, 1.f).Vector, To.Vector));
+    CHECK(Near4(FQuat::Slerp(From, To, 0.5f).Vector, FQuat::FromAxisAngle(Axis, 1.f).Vector));
+    CHECK(Near4(FQuat::Slerp(From, To, 0.25f).Vector, FQuat::FromAxisAngle(Axis, 0.6f).Vector));
+
+    //the negated quaternion is the same rotation, the shortest arc still ends on To
+    const FQuat Negated{To.Vector * Simd::float32_4{-1.f}};
+    CHECK(Near4(FQuat::Slerp(From, Negated, 1.f).Vector, To.Vector));
+    CHECK(Near4(FQuat::Slerp(From, Negated, 0.5f).Vector, FQuat::FromAxisAngle(Axis, 1.f).Vector));
+
+    //nearly equal rotations take the normalized lerp
+    const FQuat Close{FQuat::FromAxisAngle(Axis, 0.201f)};
+    CHECK(Near4(FQuat::Slerp(From, Close, 0.5f).Vector, FQuat::FromAxisAngle(Axis, 0.2005f).Vector));
+}
+
+TEST(VectorMathSoA)
+{
+    std::vector<FVector4> Vectors;
+    std::vector<FQuat> Rotations;
+    std::vector<FTransform> Transforms;
+    std::vector<FTransform> Others;
+    for(uint64 Lane{0}; Lane < 8; ++Lane)
+    {
+        Vectors.push_back(MakeVector(Lane));
+        Rotations.push_back(MakeRotation(Lane));
+        Transforms.push_back(MakeTransform(Lane));
+        Others.push_back(MakeTransform(Lane + 20));
+    }
+
+    const FVector3SoA Source{FVector3SoA::Load(Vectors.data())};
+    const FQuatSoA Quats{FQuatSoA::Load(Rotations.data())};
+    const FTransformSoA TransformsSoA{FTransformSoA::Load(Transforms.data())};
+    const FTransformSoA OthersSoA{FTransformSoA::Load(Others.data())};
+
+    std::vector<FVector4> Rotated(8);
+    std::vector<FVector4> Positions(8);
+    std::vector<FVector4> Directions(8);
+    std::vector<FQuat> Products{Rotations};
+    std::vector<FTransform> Combined{Transforms};
+
+    Quats.RotateVector(Source).Store(Rotated.data());
+    TransformsSoA.TransformPosition(Source).Store(Positions.data());
+    TransformsSoA.TransformVector(Source).Store(Directions.data());
+    (Quats * Quats).Store(Products.data());
+    (TransformsSoA * OthersSoA).Store(Combined.data());
+
+    bool bMatches{true};
+    for(uint64 Lane{0}; Lane < 8; ++Lane)
+    {
+        bMatches = bMatches && Near3(Rotated[Lane], Rotations[Lane].RotateVector(Vectors[Lane]));
+        bMatches = bMatches && Near3(Positions[Lane], Transforms[Lane].TransformPosition(Vectors[Lane]));
+        bMatches = bMatches && Near3(Directions[Lane], Transforms[Lane].TransformVector(Vectors[Lane]));
+        bMatches = bMatches && Near4(Products[Lane].Vector, (Rotations[Lane] * Rotations[Lane]).Vector);
+
+        const FTransform Expected{Transforms[Lane] * Others[Lane]};
+        bMatches = bMatches && Near4(Combined[Lane].Rotation.Vector, Expected.Rotation.Vector) && Near3(Combined[Lane].Translation, Expected.Translation)
+            && Near3(Combined[Lane].Scale3D, Expected.Scale3D);
+    }
+    CHECK(bMatches);
+
+    //Load and Store round trip
+    std::vector<FVector4> RoundTrip(8);
+    Source.Store(RoundTrip.data());
+    bool bRoundTrips{true};
+    for(uint64 Lane{0}; Lane < 8; ++Lane)
+    {
+        bRoundTrips = bRoundTrips && RoundTrip[Lane].X() == Vectors[Lane].X() && RoundTrip[Lane].Y() == Vectors[Lane].Y() && RoundTrip[Lane].Z() == Vectors[Lane].Z();
+    }
+    CHECK(bRoundTrips);
+}
@@ -0,0 +1,146 @@
+#include "TextScan.h"
+
+#include <cstring>
+
+namespace
+{
+    INLINE uint64 MatchFull(const char8* Block, const Simd::char8_32& Broadcast)
+    {
+        return StringUtility::MatchMask(Simd::Load<Simd::char8_32>(Block), Simd::Load<Simd::char8_32>(Block + 32), Broadcast);
+    }
+}
+
+uint64 TextScan::MatchBlock(const char8* Data, const uint64 Size, const uint64 Offset, const char8 Character)
+{
+    const Simd::char8_32 Broadcast{Character};
+
+    if EXPECT(Offset + BlockSize <= Size, true)
+    {
+        return MatchFull(Data + Offset, Broadcast);
+    }
+
+    if(Offset >= Size)
+    {
+        return 0;
+    }
+
+    //the only copy, the padding would match a NULL_CHAR so the bits past the end are cleared
+    alignas(32) char8 Padded[BlockSize]{};
+    Memory::Copy(Padded, Data + Offset, Size - Offset);
+
+    return MatchFull(Padded, Broadcast) & ((1ull << (Size - Offset)) - 1);
+}
+
+uint64 TextScan::CountLines(const char8* Data, const uint64 Size)
+{
+    const Simd::char8_32 Newline{'\n'};
+
+    uint64 Count{0};
+    uint64 Index{0};
+
+    //two blocks per iteration keep two popcounts and four compares independent of each other
+    for(; Index + 2 * BlockSize <= Size; Index += 2 * BlockSize)
+    {
+        Count += __builtin_popcountll(MatchFull(Data + Index, Newline)) + __builtin_popcountll(MatchFull(Data + Index + BlockSize, Newline));
+    }
+
+    for(; Index < Size; Index += BlockSize)
+    {
+        Count += __builtin_popcountll(MatchBlock(Data, Size, Index, '\n'));
+    }
+
+    return Count + (Size > 0 && Data[Size - 1] != '\n');
+}
+
+uint64 TextScan::CountMatches(const char8* Data, const uint64 Size, const FStaticString& Needle)
+{
+    FMatchScanner Scanner{Data, Size, Needle};
+
+    uint64 Count{0};
+    for(uint64 Position; Scanner.Next(Position);)
+    {
+        ++Count;
+    }
+
+    return Count;
+}
+
+FLineSpan TextScan::LineAround(const char8* Data, const uint64 Size, const uint64 Position)
+{
+    const char8* Previous{static_cast<const char8*>(memrchr(Data, '\n', Position))};
+    const uint64 Begin{Previous == nullptr ? 0 : static_cast<uint64>(Previous - Data) + 1};
+
+    const char8* Next{static_cast<const char8*>(std::memchr(Data + Position, '\n', Size - Position))};
+    const uint64 End{Next == nullptr ? Size : static_cast<uint64>(Next - Data)};
+
+    return FLineSpan{Begin, End - Begin};
+}
+
+TextScan::FLineScanner::FLineScanner(const char8* InData, const uint64 InSize)
+    : Data(InData)
+    , Size(InSize)
+    , Block(0)
+    , NextBlock(0)
+    , Newlines(0)
+    , LineStart(0)
+{
+}
+
+bool TextScan::FLineScanner::Refill()
+{
+    if(NextBlock >= Size)
+    {
+        return false;
+    }
+
+    Block = NextBlock;
+    Newlines = MatchBlock(Data, Size, Block, '\n');
+    NextBlock += BlockSize;
+
+    return true;
+}
+
+TextScan::FMatchScanner::FMatchScanner(const char8* InData, const uint64 InSize, const FStaticString& InNeedle)
+    : Data(InData)
+    , Size(InSize)
+    , Needle(InNeedle)
+    , NeedleLength(InNeedle.Length())
+    , Block(0)
+    , NextBlock(0)
+    , Candidates(0)
+{
+}
+
+bool TextScan::FMatchScanner::Refill()
+{
+    //no occurrence can start at NextBlock or later once the needle doesn't fit there
+    if(NeedleLength == 0 || NextBlock + NeedleLength > Size)
+    {
+        return false;
+    }
+
+    Block = NextBlock;
+    Candidates = MatchBlock(Data, Size, Block, Needle[0]) & MatchBlock(Data, Size, Block + NeedleLength - 1, Needle[static_cast<int32>(NeedleLength - 1)]);
+    NextBlock += BlockSize;
+
+    return true;
+}
+
+bool TextScan::FMatchScanner::IsMatch(const uint64 Position) const
+{
+    if(Position + NeedleLength > Size)
+    {
+        return false;
+    }
+
+    //the needle register is zero past its end, so only its first NeedleLength lanes have to agree
+    if EXPECT(Position + Simd::char8_32::NumElements <= Size, true)
+    {
+        const uint32 Equal{static_cast<uint32>(static_cast<int32>(Simd::Load<Simd::char8_32>(Data + Position) == Needle.GetCharacters()))};
+        const uint32 NeedleLanes{(1u << NeedleLength) - 1};
+
+        return (Equal & NeedleLanes) == NeedleLanes;
+    }
+
+    return __builtin_memcmp(Data + Position, Needle.RawString(), NeedleLength) == 0;
+}
@@ -0,0 +1,139 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "String.h"
+
+//A line without its newline, a \r before the newline stays part of the line
+struct FLineSpan final
+{
+    uint64 Begin;
+    uint64 Length;
+};
+
+//Scans text in place, typically an FMappedFile, 64 bytes at a time with char8_32 compares turned into bitmasks.
+//Nothing is copied except the last partial block, which is padded so no load reads past the end of the data
+namespace TextScan
+{
+
+    inline constexpr uint64 BlockSize{64};
+
+    //One bit per byte of the block at Offset that equals Character, bytes at or past Size never match
+    uint64 MatchBlock(const char8* Data, const uint64 Size, const uint64 Offset, const char8 Character);
+
+    //The number of newlines, plus one for a last line without a newline. Same as the number of lines FLineScanner yields
+    uint64 CountLines(const char8* Data, const uint64 Size);
+
+    //The number of positions where Needle starts, overlapping occurrences count separately
+    uint64 CountMatches(const char8* Data, const uint64 Size, const FStaticString& Needle);
+
+    //The line the byte at Position belongs to, for printing the line around a match
+    FLineSpan LineAround(const char8* Data, const uint64 Size, const uint64 Position);
+
+    //Yields the lines of the data in order. Empty lines are yielded, a newline at the very end doesn't start another line
+    class FLineScanner final
+    {
+    public:
+
+        explicit FLineScanner(const char8* InData, const uint64 InSize);
+
+        //Returns false once every line was yielded
+        inline bool Next(FLineSpan& Line)
+        {
+            while EXPECT(Newlines == 0, false)
+            {
+                if(!Refill())
+                {
+                    if(LineStart >= Size)
+                    {
+                        return false;
+                    }
+
+                    Line = FLineSpan{LineStart, Size - LineStart};
+                    LineStart = Size;
+                    return true;
+                }
+            }
+
+            const uint64 Position{Block + __builtin_ctzll(Newlines)};
+            Newlines &= Newlines - 1;
+
+            Line = FLineSpan{LineStart, Position - LineStart};
+            LineStart = Position + 1;
+            return true;
+        }
+
+    private:
+
+        bool Refill();
+
+        const char8* Data;
+        uint64 Size;
+
+        uint64 Block;
+        uint64 NextBlock;
+        uint64 Newlines; //the newlines of the current block that weren't yielded yet
+        uint64 LineStart;
+    };
+
+    //Yields the position of every occurrence of Needle in order. Candidates are the positions where the first and the last character
+    //of the needle both match, each is then checked with a single 32 byte compare. An empty needle matches nothing
+    class FMatchScanner final
+    {
+    public:
+
+        explicit FMatchScanner(const char8* InData, const uint64 InSize, const FStaticString& InNeedle);
+
+        //Returns false once every occurrence was yielded
+        inline bool Next(uint64& Position)
+        {
+            for(;;)
+            {
+                while EXPECT(Candidates == 0, false)
+                {
+                    if(!Refill())
+                    {
+                        return false;
+                    }
+                }
+
+                const uint64 Candidate{Block + __builtin_ctzll(Candidates)};
+                Candidates &= Candidates - 1;
+
+                if(IsMatch(Candidate))
+                {
+                    Position = Candidate;
+                    return true;
+                }
+            }
+        }
+
+    private:
+
+        bool Refill();
+
+        bool IsMatch(const uint64 Position) const;
+
+        const char8* Data;
+        uint64 Size;
+
+        FStaticString Needle;
+        uint32 NeedleLength;
+
+        uint64 Block;
+        uint64 NextBlock;
+        uint64 Candidates;
+    };
+
+}
@@ -0,0 +1,212 @@
+#include "VectorMath.h"
+
+using namespace VectorMath;
+
+namespace
+{
+    //2x2 matrices packed as (M00, M01, M10, M11)
+
+    //LHS * RHS
+    ATTRAVX Simd::float32_4 Matrix2Multiply(const Simd::float32_4& LHS, const Simd::float32_4& RHS)
+    {
+        return LHS * Swizzle<0, 3, 0, 3>(RHS) + Swizzle<1, 0, 3, 2>(LHS) * Swizzle<2, 1, 2, 1>(RHS);
+    }
+
+    //Adjugate(LHS) * RHS
+    ATTRAVX Simd::float32_4 Matrix2AdjugateMultiply(const Simd::float32_4& LHS, const Simd::float32_4& RHS)
+    {
+        return Swizzle<3, 3, 0, 0>(LHS) * RHS - Swizzle<1, 1, 2, 2>(LHS) * Swizzle<2, 3, 0, 1>(RHS);
+    }
+
+    //LHS * Adjugate(RHS)
+    ATTRAVX Simd::float32_4 Matrix2MultiplyAdjugate(const Simd::float32_4& LHS, const Simd::float32_4& RHS)
+    {
+        return LHS * Swizzle<3, 0, 3, 0>(RHS) - Swizzle<1, 0, 3, 2>(LHS) * Swizzle<2, 1, 2, 1>(RHS);
+    }
+
+    //Access picks the float32_4 of every source element that becomes a row. Transposing the 128 bit halves moves 8 rows of 4 floats
+    //to 4 columns of 8
+    template<typename TSource, typename TAccess>
+    ATTRAVX void LoadColumns(const TSource* Source, TAccess Access, Simd::float32_8 (&Columns)[4])
+    {
+        for(int32 Index{0}; Index < 4; ++Index)
+        {
+            Columns[Index] = Simd::ShuffleVector<Simd::float32_4, 0, 1, 2, 3, 4, 5, 6, 7>(Access(Source[Index]), Access(Source[Index + 4]));
+        }
+
+        Simd::Transpose4x4(Columns);
+    }
+
+    template<typename TTarget, typename TAccess>
+    ATTRAVX void StoreColumns(const Simd::float32_8 (&Columns)[4], TTarget* Target, TAccess Access)
+    {
+        Simd::float32_8 Pairs[4]{Columns[0], Columns[1], Columns[2], Columns[3]};
+        Simd::Transpose4x4(Pairs);
+
+        for(int32 Index{0}; Index < 4; ++Index)
+        {
+            Access(Target[Index]) = Simd::ShuffleVector<Simd::float32_8, 0, 1, 2, 3>(Pairs[Index]);
+            Access(Target[Index + 4]) = Simd::ShuffleVector<Simd::float32_8, 4, 5, 6, 7>(Pairs[Index]);
+        }
+    }
+}
+
+FMatrix44 FMatrix44::Inverse() const
+{
+    //block wise inverse of the four 2x2 sub matrices | A B |
+    //                                                | C D |
+    const Simd::float32_4 A{Shuffle<0, 1, 4, 5>(Rows[0], Rows[1])};
+    const Simd::float32_4 B{Shuffle<2, 3, 6, 7>(Rows[0], Rows[1])};
+    const Simd::float32_4 C{Shuffle<0, 1, 4, 5>(Rows[2], Rows[3])};
+    const Simd::float32_4 D{Shuffle<2, 3, 6, 7>(Rows[2], Rows[3])};
+
+    //(|A|, |B|, |C|, |D|)
+    const Simd::float32_4 SubDeterminants{Shuffle<0, 2, 4, 6>(Rows[0], Rows[2]) * Shuffle<1, 3, 5, 7>(Rows[1], Rows[3]) - Shuffle<1, 3, 5, 7>(Rows[0], Rows[2]) * Shuffle<0, 2, 4, 6>(Rows[1], Rows[3])};
+
+    const Simd::float32_4 DeterminantA{Broadcast<0>(SubDeterminants)};
+    const Simd::float32_4 DeterminantB{Broadcast<1>(SubDeterminants)};
+    const Simd::float32_4 DeterminantC{Broadcast<2>(SubDeterminants)};
+    const Simd::float32_4 DeterminantD{Broadcast<3>(SubDeterminants)};
+
+    const Simd::float32_4 AdjugateDC{Matrix2AdjugateMultiply(D, C)};
+    const Simd::float32_4 AdjugateAB{Matrix2AdjugateMultiply(A, B)};
+
+    Simd::float32_4 X{DeterminantD * A - Matrix2Multiply(B, AdjugateDC)};
+    Simd::float32_4 W{DeterminantA * D - Matrix2Multiply(C, AdjugateAB)};
+    Simd::float32_4 Y{DeterminantB * C - Matrix2MultiplyAdjugate(D, AdjugateAB)};
+    Simd::float32_4 Z{DeterminantC * B - Matrix2MultiplyAdjugate(A, AdjugateDC)};
+
+    //|M| = |A||D| + |B||C| - tr(Adjugate(A)B * Adjugate(D)C)
+    const float32 Trace{Dot4(AdjugateAB, Swizzle<0, 2, 1, 3>(AdjugateDC))};
+    const float32 Determinant{SubDeterminants[0] * SubDeterminants[3] + SubDeterminants[1] * SubDeterminants[2] - Trace};
+
+    const Simd::float32_4 ReciprocalDeterminant{Simd::float32_4{1.f, -1.f, -1.f, 1.f} / Simd::float32_4{Determinant}};
+
+    X *= ReciprocalDeterminant;
+    Y *= ReciprocalDeterminant;
+    Z *= ReciprocalDeterminant;
+    W *= ReciprocalDeterminant;
+
+    //the shuffles apply the adjugate of every block while writing the rows
+    FMatrix44 Result;
+    Result.Rows[0] = Shuffle<3, 1, 7, 5>(X, Y);
+    Result.Rows[1] = Shuffle<2, 0, 6, 4>(X, Y);
+    Result.Rows[2] = Shuffle<3, 1, 7, 5>(Z, W);
+    Result.Rows[3] = Shuffle<2, 0, 6, 4>(Z, W);
+    return Result;
+}
+
+FQuat FQuat::Slerp(const FQuat& From, const FQuat& To, const float32 Alpha)
+{
+    float32 CosAngle{Dot4(From.Vector, To.Vector)};
+    Simd::float32_4 Target{To.Vector};
+
+    if(CosAngle < 0.f)
+    {
+        CosAngle = -CosAngle;
+        Target *= Simd::float32_4{-1.f};
+    }
+
+    if(CosAngle > 0.9995f)
+    {
+        return FQuat{From.Vector * Simd::float32_4{1.f - Alpha} + Target * Simd::float32_4{Alpha}}.Normalized();
+    }
+
+    const float32 Angle{std::acos(CosAngle)};
+    const float32 InverseSin{1.f / std::sin(Angle)};
+
+    const float32 FromScale{std::sin((1.f - Alpha) * Angle) * InverseSin};
+    const float32 ToScale{std::sin(Alpha * Angle) * InverseSin};
+
+    return FQuat{From.Vector * Simd::float32_4{FromScale} + Target * Simd::float32_4{ToScale}};
+}
+
+FMatrix44 FQuat::ToMatrix() const
+{
+    const float32 X{Vector[0]};
+    const float32 Y{Vector[1]};
+    const float32 Z{Vector[2]};
+    const float32 W{Vector[3]};
+
+    const float32 X2{X + X}, Y2{Y + Y}, Z2{Z + Z};
+    const float32 XX{X * X2}, XY{X * Y2}, XZ{X * Z2};
+    const float32 YY{Y * Y2}, YZ{Y * Z2}, ZZ{Z * Z2};
+    const float32 WX{W * X2}, WY{W * Y2}, WZ{W * Z2};
+
+    return FMatrix44
+    {
+        FVector4{1.f - (YY + ZZ), XY + WZ, XZ - WY, 0.f},
+        FVector4{XY - WZ, 1.f - (XX + ZZ), YZ + WX, 0.f},
+        FVector4{XZ + WY, YZ - WX, 1.f - (XX + YY), 0.f},
+        FVector4{0.f, 0.f, 0.f, 1.f}
+    };
+}
+
+FMatrix44 FTransform::ToMatrix() const
+{
+    FMatrix44 Result{Rotation.ToMatrix()};
+
+    Result.Rows[0] *= Broadcast<0>(Scale3D.Vector);
+    Result.Rows[1] *= Broadcast<1>(Scale3D.Vector);
+    Result.Rows[2] *= Broadcast<2>(Scale3D.Vector);
+    Result.Rows[3] = Translation.Vector * Simd::float32_4{1.f, 1.f, 1.f, 0.f} + Simd::float32_4{0.f, 0.f, 0.f, 1.f};
+
+    return Result;
+}
+
+FVector3SoA FVector3SoA::Load(const FVector4* Vectors)
+{
+    Simd::float32_8 Columns[4];
+    LoadColumns(Vectors, [](const FVector4& Vector) -> const Simd::float32_4& { return Vector.Vector; }, Columns);
+
+    return FVector3SoA{Columns[0], Columns[1], Columns[2]};
+}
+
+void FVector3SoA::Store(FVector4* Vectors) const
+{
+    const Simd::float32_8 Columns[4]{X, Y, Z, Simd::float32_8{0.f}};
+    StoreColumns(Columns, Vectors, [](FVector4& Vector) -> Simd::float32_4& { return Vector.Vector; });
+}
+
+FQuatSoA FQuatSoA::Load(const FQuat* Quats)
+{
+    Simd::float32_8 Columns[4];
+    LoadColumns(Quats, [](const FQuat& Quat) -> const Simd::float32_4& { return Quat.Vector; }, Columns);
+
+    return FQuatSoA{Columns[0], Columns[1], Columns[2], Columns[3]};
+}
+
+void FQuatSoA::Store(FQuat* Quats) const
+{
+    const Simd::float32_8 Columns[4]{X, Y, Z, W};
+    StoreColumns(Columns, Quats, [](FQuat& Quat) -> Simd::float32_4& { return Quat.Vector; });
+}
+
+FTransformSoA FTransformSoA::Load(const FTransform* Transforms)
+{
+    Simd::float32_8 Rotations[4];
+    Simd::float32_8 Translations[4];
+    Simd::float32_8 Scales[4];
+
+    LoadColumns(Transforms, [](const FTransform& Transform) -> const Simd::float32_4& { return Transform.Rotation.Vector; }, Rotations);
+    LoadColumns(Transforms, [](const FTransform& Transform) -> const Simd::float32_4& { return Transform.Translation.Vector; }, Translations);
+    LoadColumns(Transforms, [](const FTransform& Transform) -> const Simd::float32_4& { return Transform.Scale3D.Vector; }, Scales);
+
+    return FTransformSoA
+    {
+        FQuatSoA{Rotations[0], Rotations[1], Rotations[2], Rotations[3]},
+        FVector3SoA{Translations[0], Translations[1], Translations[2]},
+        FVector3SoA{Scales[0], Scales[1], Scales[2]}
+    };
+}
+
+void FTransformSoA::Store(FTransform* Transforms) const
+{
+    const Simd::float32_8 Rotations[4]{Rotation.X, Rotation.Y, Rotation.Z, Rotation.W};
+    const Simd::float32_8 Translations[4]{Translation.X, Translation.Y, Translation.Z, Simd::float32_8{0.f}};
+    const Simd::float32_8 Scales[4]{Scale3D.X, Scale3D.Y, Scale3D.Z, Simd::float32_8{0.f}};
+
+    StoreColumns(Rotations, Transforms, [](FTransform& Transform) -> Simd::float32_4& { return Transform.Rotation.Vector; });
+    StoreColumns(Translations, Transforms, [](FTransform& Transform) -> Simd::float32_4& { return Transform.Translation.Vector; });
+    StoreColumns(Scales, Transforms, [](FTransform& Transform) -> Simd::float32_4& { return Transform.Scale3D.Vector; });
+}
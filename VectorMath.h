@@ -0,0 +1,438 @@
+/*
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cmath>
+#include "Simd.h"
+
+//Follows the Unreal conventions: vectors are row vectors transformed as V * M, so A * B applies A first and then B.
+//FQuat multiplication is the exception, A * B applies B first
+
+namespace VectorMath
+{
+    template<int32... Control>
+    ATTRAVX Simd::float32_4 Swizzle(const Simd::float32_4& Source)
+    {
+        return Simd::float32_4{Simd::ShuffleVector<Simd::float32_4, Control...>(Source)};
+    }
+
+    template<int32... Control>
+    ATTRAVX Simd::float32_4 Shuffle(const Simd::float32_4& LHS, const Simd::float32_4& RHS)
+    {
+        return Simd::float32_4{Simd::ShuffleVector<Simd::float32_4, Control...>(LHS, RHS)};
+    }
+
+    template<int32 Lane>
+    ATTRAVX Simd::float32_4 Broadcast(const Simd::float32_4& Source)
+    {
+        return Swizzle<Lane, Lane, Lane, Lane>(Source);
+    }
+
+    //a.yzx * b.zxy - a.zxy * b.yzx, the fourth lane becomes 0
+    ATTRAVX Simd::float32_4 Cross3(const Simd::float32_4& LHS, const Simd::float32_4& RHS)
+    {
+        return Swizzle<1, 2, 0, 3>(LHS) * Swizzle<2, 0, 1, 3>(RHS) - Swizzle<2, 0, 1, 3>(LHS) * Swizzle<1, 2, 0, 3>(RHS);
+    }
+
+    ATTRAVX float32 Dot3(const Simd::float32_4& LHS, const Simd::float32_4& RHS)
+    {
+        const Simd::float32_4 Product{LHS * RHS};
+        return Product[0] + Product[1] + Product[2];
+    }
+
+    ATTRAVX float32 Dot4(const Simd::float32_4& LHS, const Simd::float32_4& RHS)
+    {
+        const Simd::float32_4 Product{LHS * RHS};
+        const Simd::float32_4 Pairs{Product + Swizzle<2, 3, 0, 1>(Product)};
+        return Pairs[0] + Pairs[1];
+    }
+}
+
+//3D vector with a fourth component that is carried along, the 3D operations ignore W
+class FVector4 final
+{
+public:
+
+    ATTRAVX FVector4()
+        : Vector(0.f)
+    {
+    }
+
+    ATTRAVX FVector4(const float32 X, const float32 Y, const float32 Z, const float32 W = 0.f)
+        : Vector(X, Y, Z, W)
+    {
+    }
+
+    ATTRAVX explicit FVector4(const Simd::float32_4& Other)
+        : Vector(Other)
+    {
+    }
+
+    ATTRAVX float32 X() const { return Vector[0]; }
+    ATTRAVX float32 Y() const { return Vector[1]; }
+    ATTRAVX float32 Z() const { return Vector[2]; }
+    ATTRAVX float32 W() const { return Vector[3]; }
+
+    ATTRAVX FVector4 operator+(const FVector4& Other) const
+    {
+        return FVector4{Vector + Other.Vector};
+    }
+
+    ATTRAVX FVector4 operator-(const FVector4& Other) const
+    {
+        return FVector4{Vector - Other.Vector};
+    }
+
+    ATTRAVX FVector4 operator*(const FVector4& Other) const
+    {
+        return FVector4{Vector * Other.Vector};
+    }
+
+    ATTRAVX FVector4 operator*(const float32 Scale) const
+    {
+        return FVector4{Vector * Simd::float32_4{Scale}};
+    }
+
+    ATTRAVX FVector4 operator/(const FVector4& Other) const
+    {
+        return FVector4{Vector / Other.Vector};
+    }
+
+    ATTRAVX float32 Dot3(const FVector4& Other) const
+    {
+        return VectorMath::Dot3(Vector, Other.Vector);
+    }
+
+    ATTRAVX float32 Dot4(const FVector4& Other) const
+    {
+        return VectorMath::Dot4(Vector, Other.Vector);
+    }
+
+    ATTRAVX FVector4 Cross3(const FVector4& Other) const
+    {
+        return FVector4{VectorMath::Cross3(Vector, Other.Vector)};
+    }
+
+    ATTRAVX float32 Length3() const
+    {
+        return std::sqrt(Dot3(*this));
+    }
+
+    ATTRAVX FVector4 Normal3() const
+    {
+        return *this * (1.f / Length3());
+    }
+
+public:
+
+    Simd::float32_4 Vector;
+
+};
+
+//4x4 row major matrix, the translation lives in the last row
+class FMatrix44 final
+{
+public:
+
+    ATTRAVX static FMatrix44 Identity()
+    {
+        return FMatrix44{FVector4{1.f, 0.f, 0.f, 0.f}, FVector4{0.f, 1.f, 0.f, 0.f}, FVector4{0.f, 0.f, 1.f, 0.f}, FVector4{0.f, 0.f, 0.f, 1.f}};
+    }
+
+    ATTRAVX FMatrix44()
+        : Rows{Simd::float32_4{0.f}, Simd::float32_4{0.f}, Simd::float32_4{0.f}, Simd::float32_4{0.f}}
+    {
+    }
+
+    ATTRAVX FMatrix44(const FVector4& Row0, const FVector4& Row1, const FVector4& Row2, const FVector4& Row3)
+        : Rows{Row0.Vector, Row1.Vector, Row2.Vector, Row3.Vector}
+    {
+    }
+
+    //each result row is the LHS row times this matrix, built from broadcasts so no horizontal adds are needed
+    ATTRAVX FMatrix44 operator*(const FMatrix44& Other) const
+    {
+        FMatrix44 Result;
+
+        for(int32 Row{0}; Row < 4; ++Row)
+        {
+            Result.Rows[Row] = Other.TransformRow(Rows[Row]);
+        }
+
+        return Result;
+    }
+
+    ATTRAVX FVector4 TransformVector4(const FVector4& Source) const
+    {
+        return FVector4{TransformRow(Source.Vector)};
+    }
+
+    //transforms with W = 1 so the translation applies
+    ATTRAVX FVector4 TransformPosition(const FVector4& Source) const
+    {
+        const Simd::float32_4& Point{Source.Vector};
+        return FVector4{VectorMath::Broadcast<0>(Point) * Rows[0] + VectorMath::Broadcast<1>(Point) * Rows[1] + VectorMath::Broadcast<2>(Point) * Rows[2] + Rows[3]};
+    }
+
+    ATTRAVX FMatrix44 Transposed() const
+    {
+        FMatrix44 Result{*this};
+        Simd::Transpose4x4(Result.Rows);
+        return Result;
+    }
+
+    //general inverse, the result is undefined for singular matrices
+    FMatrix44 Inverse() const;
+
+    ATTRAVX float32 operator()(const int32 Row, const int32 Column) const
+    {
+        return Rows[Row][Column];
+    }
+
+    ATTRAVX float32& operator()(const int32 Row, const int32 Column)
+    {
+        return Rows[Row][Column];
+    }
+
+private:
+
+    ATTRAVX Simd::float32_4 TransformRow(const Simd::float32_4& Row) const
+    {
+        using namespace VectorMath;
+        return Broadcast<0>(Row) * Rows[0] + Broadcast<1>(Row) * Rows[1] + Broadcast<2>(Row) * Rows[2] + Broadcast<3>(Row) * Rows[3];
+    }
+
+public:
+
+    Simd::float32_4 Rows[4];
+
+};
+
+//rotation quaternion stored as X, Y, Z, W
+class FQuat final
+{
+public:
+
+    ATTRAVX static FQuat Identity()
+    {
+        return FQuat{0.f, 0.f, 0.f, 1.f};
+    }
+
+    ATTRAVX static FQuat FromAxisAngle(const FVector4& Axis, const float32 AngleRadians)
+    {
+        const float32 HalfAngle{AngleRadians * 0.5f};
+        const float32 Sin{std::sin(HalfAngle)};
+
+        return FQuat{Axis.X() * Sin, Axis.Y() * Sin, Axis.Z() * Sin, std::cos(HalfAngle)};
+    }
+
+    ATTRAVX FQuat(const float32 X, const float32 Y, const float32 Z, const float32 W)
+        : Vector(X, Y, Z, W)
+    {
+    }
+
+    ATTRAVX explicit FQuat(const Simd::float32_4& Other)
+        : Vector(Other)
+    {
+    }
+
+    //Hamilton product, the result applies Other first and then this
+    ATTRAVX FQuat operator*(const FQuat& Other) const
+    {
+        using namespace VectorMath;
+
+        const Simd::float32_4& Q{Other.Vector};
+
+        Simd::float32_4 Result{Broadcast<3>(Vector) * Q};
+        Result += Broadcast<0>(Vector) * Swizzle<3, 2, 1, 0>(Q) * Simd::float32_4{1.f, -1.f, 1.f, -1.f};
+        Result += Broadcast<1>(Vector) * Swizzle<2, 3, 0, 1>(Q) * Simd::float32_4{1.f, 1.f, -1.f, -1.f};
+        Result += Broadcast<2>(Vector) * Swizzle<1, 0, 3, 2>(Q) * Simd::float32_4{-1.f, 1.f, 1.f, -1.f};
+
+        return FQuat{Result};
+    }
+
+    //V + 2W(Q x V) + 2Q x (Q x V), written with T = 2(Q x V)
+    ATTRAVX FVector4 RotateVector(const FVector4& Source) const
+    {
+        using namespace VectorMath;
+
+        const Simd::float32_4 T{Cross3(Vector, Source.Vector) * Simd::float32_4{2.f}};
+
+        return FVector4{Source.Vector + Broadcast<3>(Vector) * T + Cross3(Vector, T)};
+    }
+
+    ATTRAVX FQuat Inverse() const
+    {
+        return FQuat{Vector * Simd::float32_4{-1.f, -1.f, -1.f, 1.f}};
+    }
+
+    ATTRAVX FQuat Normalized() const
+    {
+        return FQuat{Vector * Simd::float32_4{1.f / std::sqrt(VectorMath::Dot4(Vector, Vector))}};
+    }
+
+    //spherical interpolation along the shortest arc, falls back to a normalized lerp when the rotations are nearly equal
+    static FQuat Slerp(const FQuat& From, const FQuat& To, const float32 Alpha);
+
+    FMatrix44 ToMatrix() const;
+
+public:
+
+    Simd::float32_4 Vector;
+
+};
+
+//scale, then rotate, then translate
+class FTransform final
+{
+public:
+
+    ATTRAVX FTransform()
+        : Rotation(FQuat::Identity())
+        , Translation(0.f, 0.f, 0.f, 0.f)
+        , Scale3D(1.f, 1.f, 1.f, 0.f)
+    {
+    }
+
+    ATTRAVX FTransform(const FQuat& InRotation, const FVector4& InTranslation, const FVector4& InScale3D = FVector4{1.f, 1.f, 1.f, 0.f})
+        : Rotation(InRotation)
+        , Translation(InTranslation)
+        , Scale3D(InScale3D)
+    {
+    }
+
+    ATTRAVX FVector4 TransformPosition(const FVector4& Source) const
+    {
+        return Rotation.RotateVector(Source * Scale3D) + Translation;
+    }
+
+    ATTRAVX FVector4 TransformVector(const FVector4& Source) const
+    {
+        return Rotation.RotateVector(Source * Scale3D);
+    }
+
+    //applies this first and then Other, non uniform scale combined with rotation can't be represented exactly and is approximated like Unreal does
+    ATTRAVX FTransform operator*(const FTransform& Other) const
+    {
+        return FTransform{Other.Rotation * Rotation, Other.TransformPosition(Translation), Scale3D * Other.Scale3D};
+    }
+
+    FMatrix44 ToMatrix() const;
+
+public:
+
+    FQuat Rotation;
+    FVector4 Translation;
+    FVector4 Scale3D;
+
+};
+
+//8 3D vectors as structure of arrays, one float32_8 per component
+struct FVector3SoA final
+{
+    ATTRAVX FVector3SoA operator+(const FVector3SoA& Other) const
+    {
+        return FVector3SoA{X + Other.X, Y + Other.Y, Z + Other.Z};
+    }
+
+    ATTRAVX FVector3SoA operator-(const FVector3SoA& Other) const
+    {
+        return FVector3SoA{X - Other.X, Y - Other.Y, Z - Other.Z};
+    }
+
+    ATTRAVX FVector3SoA operator*(const FVector3SoA& Other) const
+    {
+        return FVector3SoA{X * Other.X, Y * Other.Y, Z * Other.Z};
+    }
+
+    ATTRAVX FVector3SoA operator*(const Simd::float32_8& Scale) const
+    {
+        return FVector3SoA{X * Scale, Y * Scale, Z * Scale};
+    }
+
+    ATTRAVX Simd::float32_8 Dot(const FVector3SoA& Other) const
+    {
+        return X * Other.X + Y * Other.Y + Z * Other.Z;
+    }
+
+    ATTRAVX FVector3SoA Cross(const FVector3SoA& Other) const
+    {
+        return FVector3SoA{Y * Other.Z - Z * Other.Y, Z * Other.X - X * Other.Z, X * Other.Y - Y * Other.X};
+    }
+
+    static FVector3SoA Load(const FVector4* Vectors);
+    void Store(FVector4* Vectors) const;
+
+    Simd::float32_8 X;
+    Simd::float32_8 Y;
+    Simd::float32_8 Z;
+};
+
+//8 quaternions as structure of arrays
+struct FQuatSoA final
+{
+    ATTRAVX FQuatSoA operator*(const FQuatSoA& Other) const
+    {
+        return FQuatSoA
+        {
+            W * Other.X + X * Other.W + Y * Other.Z - Z * Other.Y,
+            W * Other.Y - X * Other.Z + Y * Other.W + Z * Other.X,
+            W * Other.Z + X * Other.Y - Y * Other.X + Z * Other.W,
+            W * Other.W - X * Other.X - Y * Other.Y - Z * Other.Z
+        };
+    }
+
+    ATTRAVX FVector3SoA RotateVector(const FVector3SoA& Source) const
+    {
+        const FVector3SoA Axis{X, Y, Z};
+        const FVector3SoA T{Axis.Cross(Source) * Simd::float32_8{2.f}};
+
+        return Source + T * W + Axis.Cross(T);
+    }
+
+    static FQuatSoA Load(const FQuat* Quats);
+    void Store(FQuat* Quats) const;
+
+    Simd::float32_8 X;
+    Simd::float32_8 Y;
+    Simd::float32_8 Z;
+    Simd::float32_8 W;
+};
+
+//8 transforms as structure of arrays, for skinning and scene graph updates that run at full vector width
+struct FTransformSoA final
+{
+    ATTRAVX FVector3SoA TransformPosition(const FVector3SoA& Source) const
+    {
+        return Rotation.RotateVector(Source * Scale3D) + Translation;
+    }
+
+    ATTRAVX FVector3SoA TransformVector(const FVector3SoA& Source) const
+    {
+        return Rotation.RotateVector(Source * Scale3D);
+    }
+
+    //applies this first and then Other, lane by lane
+    ATTRAVX FTransformSoA operator*(const FTransformSoA& Other) const
+    {
+        return FTransformSoA{Other.Rotation * Rotation, Other.TransformPosition(Translation), Scale3D * Other.Scale3D};
+    }
+
+    static FTransformSoA Load(const FTransform* Transforms);
+    void Store(FTransform* Transforms) const;
+
+    FQuatSoA Rotation;
+    FVector3SoA Translation;
+    FVector3SoA Scale3D;
+};